@@ -24,8 +24,9 @@ static void app_terminal() {
     char command[COMMAND_LENGTH] = {0};
     // Go to terminal mode
     plat_core_active_term(true);
-    // Force a draw
-    global.view.terminal.modified = true;
+    // Format what came in while the board was showing, and force a draw
+    log_flush(&global.view.terminal);
+    log_invalidate(&global.view.terminal);
     // Run the input while updating the terminal and net
     input_text(command, COMMAND_LENGTH, FILTER_ALLOW_ALL);
     // Done with terminal mode
@@ -33,51 +34,105 @@ static void app_terminal() {
     // Redraw the board
     global.view.refresh = true;
     // Force a redraw of the status log
-    global.view.info_panel.modified = true;
+    log_invalidate(&global.view.info_panel);
     // If the menu should be visible, make sure to draw it again
     if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
         global.view.mc.df = MENU_DRAW;
     }
 }
 
+/*-----------------------------------------------------------------------*/
+// Redraw only the squares whose piece differs from what's on screen
+static void app_draw_board_changes() {
+    uint8_t i;
+    bool drawn = false;
+    for (i = 0; i < 64; ++i) {
+        if (global.state.chess_board[i] != global.state.drawn_board[i]) {
+            plat_draw_square(i);
+            drawn = true;
+        }
+    }
+    // A menu may have been drawn over one of those squares
+    if (drawn && !(global.view.mc.df & MENU_DRAW_HIDDEN)) {
+        global.view.mc.df = MENU_DRAW;
+    }
+    global.view.board_changed = false;
+}
+
+/*-----------------------------------------------------------------------*/
+// Clear the status area from row down when app_draw_update next runs, just
+// before the status log is drawn into it.  Clears asked for in between
+// become one clear
+void app_draw_clear_statslog(uint8_t row) {
+    if (row < global.view.statslog_clear_row) {
+        global.view.statslog_clear_row = row;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// True if app_draw_update has board or status drawing to do
+bool app_draw_pending() {
+    return !global.view.terminal_active &&
+           (global.view.refresh || global.view.board_changed || global.view.info_panel.modified ||
+            global.view.statslog_clear_row != CLEAR_ROW_NONE);
+}
+
 /*-----------------------------------------------------------------------*/
 void app_draw_update() {
+    uint8_t cursor, selected;
+
     if (global.view.terminal_active) {
         if (global.view.terminal.modified) {
             plat_draw_log(&global.view.terminal, 0, 0, false);
         }
     } else {
-        // Board needs to be updated
+        // Whole board needs to be redrawn
         if (global.view.refresh) {
-            global.state.prev_cursor = -1;
+            global.view.board_changed = false;
             plat_draw_board();
-            if (global.view.info_panel.modified) {
-                plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
-            }
             // If the menu is not hideen, it also needs to draw, on top
             // of the updated board
             if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
                 global.view.mc.df = MENU_DRAW;
             }
+        } else if (global.view.board_changed) {
+            app_draw_board_changes();
         }
 
-        // Update cursor and selection if needed
-        if (global.state.includes_me && (global.state.prev_cursor != global.state.cursor)) {
-            if (global.state.prev_cursor >= 0) {
-                plat_draw_square(global.state.prev_cursor);  // erase old cursor
+        if (global.view.statslog_clear_row != CLEAR_ROW_NONE) {
+            plat_draw_clear_statslog_area(global.view.statslog_clear_row);
+            // Those rows are blank, so the log doesn't have to pad them out
+            memset(global.view.info_panel.shown + global.view.statslog_clear_row, 0,
+                   plat_core_get_rows() - global.view.statslog_clear_row);
+            global.view.statslog_clear_row = CLEAR_ROW_NONE;
+            if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
+                global.view.mc.df = MENU_DRAW;
+            }
+        }
+
+        if (global.view.info_panel.modified) {
+            plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
+            // The menu overlaps the status area
+            if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
+                global.view.mc.df = MENU_DRAW;
             }
+        }
+
+        // Move the cursor and selection markers if needed.  They are kept
+        // off the board while a menu is up, since they may be overlays
+        cursor = selected = MARKER_NONE;
+        if (global.state.includes_me && (global.view.mc.df & MENU_DRAW_HIDDEN)) {
+            cursor = global.state.cursor;
             if (global.state.selector_index) {
-                // show selected tile in its cursor
-                plat_draw_highlight(global.state.selector[0], HCOLOR_SELECTED);
-                if (global.state.cursor != global.state.selector[0]) {
-                    // show a second (basic) cursor if it's moved from selected[0]
-                    plat_draw_highlight(global.state.cursor, HCOLOR_VALID);
+                selected = global.state.selector[0];
+                // The selection marker shows the cursor when it's on the selected square
+                if (cursor == selected) {
+                    cursor = MARKER_NONE;
                 }
-            } else {
-                // Show the basic cursor
-                plat_draw_highlight(global.state.cursor, HCOLOR_VALID);
             }
-            global.state.prev_cursor = global.state.cursor;
+        }
+        if (cursor != global.state.markers[MARKER_CURSOR] || selected != global.state.markers[MARKER_SELECTED]) {
+            plat_draw_markers(cursor, selected);
         }
     }
 }
@@ -87,6 +142,7 @@ void app_error(bool fatal, const char *error_text) {
     plat_core_active_term(true);
     log_add_line(&global.view.terminal, error_text, -1);
     log_add_line(&global.view.terminal, "Press a key", -1);
+    log_invalidate(&global.view.terminal);
     plat_draw_log(&global.view.terminal, 0, 0, MENU_COLOR_TITLE);
     plat_draw_update();
     plat_core_key_wait_any();
@@ -271,6 +327,31 @@ void app_user_input() {
         }
     }
 
+    // The cursor moves the way it shows on screen, so on a flipped board
+    // up is down and left is right
+    if (global.view.flip) {
+        switch (global.os.input_event.code) {
+            case INPUT_LEFT:
+                global.os.input_event.code = INPUT_RIGHT;
+                break;
+
+            case INPUT_RIGHT:
+                global.os.input_event.code = INPUT_LEFT;
+                break;
+
+            case INPUT_UP:
+                global.os.input_event.code = INPUT_DOWN;
+                break;
+
+            case INPUT_DOWN:
+                global.os.input_event.code = INPUT_UP;
+                break;
+
+            default:
+                break;
+        }
+    }
+
     switch (global.os.input_event.code) {
         case INPUT_UP:              // global.state.cursor
             global.state.cursor -= 8;
@@ -307,7 +388,7 @@ void app_user_input() {
             if (global.state.my_move || !global.state.selector_index || (global.state.selector_index && global.state.cursor == global.state.selector[0])) {
                 uint8_t piece;
                 bool side;
-                piece = fics_letter_to_piece(global.state.chess_board[global.state.cursor]);
+                piece = global.state.chess_board[global.state.cursor];
                 side = piece & PIECE_WHITE ? SIDE_WHITE : SIDE_BLACK;
                 piece &= ~PIECE_WHITE;
                 // First selection or clearing first selection
@@ -332,10 +413,7 @@ void app_user_input() {
                         plat_net_send(global.state.move_str);
                     }
                     global.state.selector_index = 0;
-                    plat_draw_square(global.state.selector[0]);
                 }
-                // Force a redraw of the cursor
-                global.state.prev_cursor = -1;
             }
             break;
 
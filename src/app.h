@@ -16,6 +16,8 @@ enum {
     APP_STATE_ONLINE,
 };
 
+void app_draw_clear_statslog(uint8_t row);
+bool app_draw_pending(void);
 void app_draw_update(void);
 void app_error(bool fatal, const char *error_text);
 void app_set_state(uint8_t new_state);
@@ -281,19 +281,51 @@ char pieces[] =
     "                     "
     ;
 
-int main(void) {
+// 3 bytes of 7 pixels across and 22 rows per piece, in 2 versions
+#define TILE_SIZE   (3 * 22)
+
+unsigned char images[6][2][TILE_SIZE];
+unsigned char blank[TILE_SIZE];
+
+// Write a piece as it shows on a dark or a light square.  On a light square
+// it's inverted.  The high (palette) bit is set on every byte so the tile
+// can be copied to the screen as is
+void tile(int f, const unsigned char *image, int light) {
     int i;
-    int f = open("pieces.bin", O_CREAT | O_TRUNC | O_WRONLY);
+    char c;
+
+    for (i = 0; i < TILE_SIZE; ++i) {
+        c = (light ? ~image[i] : image[i]) | 0x80;
+        write(f, &c, 1);
+    }
+}
+
+int main(void) {
+    int i, piece, side;
+    int f = open("tiles.bin", O_CREAT | O_TRUNC | O_WRONLY, 0644);
+    unsigned char *image = &images[0][0][0];
     char c = 0;
 
     for (i = 0; i < sizeof(pieces); ++i) {
         c |= (pieces[i] == '*') << i % 7;
         if (i % 7 == 6) {
-            write(f, &c, 1);
+            *image++ = c;
             c = 0;
         }
     }
 
+    // The empty square, then each piece in black and in white.  Every tile
+    // is there for a dark and a light square.  On a light square the other
+    // version of the piece is used, since the tile gets inverted
+    tile(f, blank, 0);
+    tile(f, blank, 1);
+    for (piece = 0; piece < 6; ++piece) {
+        for (side = 0; side < 2; ++side) {
+            tile(f, images[piece][side], 0);
+            tile(f, images[piece][!side], 1);
+        }
+    }
+
     close(f);
     return 0;
 }
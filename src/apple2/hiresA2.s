@@ -6,8 +6,9 @@
 ;
 ;
 
-.export _hires_char_set, _hires_pieces
-.export _hires_init, _hires_done, _hires_draw, _hires_mask
+.export _hires_char_set, _hires_tiles
+.export _hires_init, _hires_done, _hires_draw, _hires_copy, _hires_mask, _hires_save, _hires_text
+.export _hires_flip
 
 .include "apple2.inc"
 .include "zeropage.inc"
@@ -16,6 +17,31 @@
 
 VERSION  := $FBB3
 
+; Built with HIRES_PAGE_FLIP, drawing goes to the HGR page that isn't showing
+; and hires_flip shows it.  The rows each call changes are noted, so that
+; the flip only has to copy those across to the page that was showing
+
+; The high byte of a row address, in the page being drawn to
+.macro  basehi
+        lda     BASEHI,x
+.ifdef HIRES_PAGE_FLIP
+        eor     back        ; $00 for page 1, $60 for page 2
+.endif
+.endmacro
+
+; Note that rows X up to y1, columns x0 up to x1 are being drawn to
+.macro  dirty   y1, x0, x1
+.ifdef HIRES_PAGE_FLIP
+        lda     y1
+        sta     dirty_y1
+        lda     x0
+        sta     dirty_x0
+        lda     x1
+        sta     dirty_x1
+        jsr     mark_dirty
+.endif
+.endmacro
+
 
 .rodata
 
@@ -33,8 +59,21 @@ BASEHI:
 _hires_char_set:
 .incbin "charset.bin"
 
-_hires_pieces:
-.incbin "pieces.bin"
+_hires_tiles:
+.incbin "tiles.bin"
+
+.ifdef HIRES_PAGE_FLIP
+
+.bss
+
+; Per row, the first and one past the last column drawn since the last flip.
+; A row with nothing drawn has DIRTYHI 0
+DIRTYLO:
+        .res    $C0
+DIRTYHI:
+        .res    $C0
+
+.endif
 
 
 .code
@@ -58,7 +97,45 @@ _hires_pieces:
         bit     HIRES
 
         lda     #20
-        sta     WNDTOP      ; Prepare hires_text()
+        sta     WNDTOP      ; Text window for mixed mode
+
+.ifdef HIRES_PAGE_FLIP
+        lda     ready
+        bne     show
+
+        ldy     #$00        ; Start page 2 off as a copy of page 1
+        sty     ptr1
+        sty     ptr2
+        lda     #>$2000
+        sta     ptr1+1
+        lda     #>$4000
+        sta     ptr2+1
+        ldx     #>$2000     ; Pages in a screen
+:       lda     (ptr1),y
+        sta     (ptr2),y
+        iny
+        bne     :-
+        inc     ptr1+1
+        inc     ptr2+1
+        dex
+        bne     :-
+
+        lda     #$FF        ; Nothing drawn yet
+        ldx     #$C0
+:       sta     DIRTYLO-1,x
+        dex
+        bne     :-
+
+        lda     #$60        ; Draw to page 2
+        sta     back
+        sta     ready
+
+show:   lda     back        ; Show the page not drawn to
+        bne     :+
+        bit     $C055       ; Page 2
+        rts
+:       bit     $C054       ; Page 1
+.endif
         rts
 
 .endproc
@@ -67,6 +144,9 @@ _hires_pieces:
 .proc   _hires_done
 
         bit     TXTSET
+.ifdef HIRES_PAGE_FLIP
+        bit     $C054       ; Text is on page 1
+.endif
 
         lda     #00
         sta     WNDTOP      ; Back to full screen text
@@ -106,10 +186,12 @@ _hires_pieces:
         clc
         adc     xmax+1
         sta     xmax+1
+
+        dirty   ymax+1, xpos+1, xmax+1
 yloop:
         lda     BASELO,x
         sta     dst+1
-        lda     BASEHI,x
+        basehi
         sta     dst+2
 
 xpos:   ldx     #$FF        ; Patched
@@ -132,6 +214,57 @@ ymax:   cpx     #$FF        ; Patched
 .endproc
 
 
+.proc   _hires_copy
+
+        sta     src+1       ; 'src' lo
+        stx     src+2       ; 'src' hi
+
+        jsr     popa        ; 'ysize'
+        sta     ymax+1
+
+        jsr     popa        ; 'xsize'
+        sta     xmax+1
+
+        jsr     popa        ; 'ypos'
+        sta     ypos+1
+        tax
+
+        clc
+        adc     ymax+1
+        sta     ymax+1
+
+        jsr     popa        ; 'xpos'
+        sta     xpos+1
+
+        clc
+        adc     xmax+1
+        sta     xmax+1
+
+        dirty   ymax+1, xpos+1, xmax+1
+yloop:
+        lda     BASELO,x
+        sta     dst+1
+        basehi
+        sta     dst+2
+
+xpos:   ldx     #$FF        ; Patched
+xloop:
+src:    lda     $FFFF,y     ; Patched
+        iny
+dst:    sta     $FFFF,x     ; Patched
+        inx
+xmax:   cpx     #$FF        ; Patched
+        bne     xloop
+
+        inc     ypos+1
+ypos:   ldx     #$FF        ; Patched
+ymax:   cpx     #$FF        ; Patched
+        bne     yloop
+        rts
+
+.endproc
+
+
 .proc   _hires_mask
 
         stx     rop         ; 'rop' hi
@@ -157,11 +290,12 @@ ymax:   cpx     #$FF        ; Patched
         adc     xmax+1
         sta     xmax+1
 
+        dirty   ymax+1, xpos+1, xmax+1
 yloop:
         lda     BASELO,x
         sta     src+1
         sta     dst+1
-        lda     BASEHI,x
+        basehi
         sta     src+2
         sta     dst+2
 
@@ -181,3 +315,239 @@ ymax:   cpx     #$FF        ; Patched
         rts
 
 .endproc
+
+
+.proc   _hires_save
+
+        sta     dst+1       ; 'dst' lo
+        stx     dst+2       ; 'dst' hi
+
+        jsr     popa        ; 'ysize'
+        sta     ymax+1
+
+        jsr     popa        ; 'xsize'
+        sta     xmax+1
+
+        jsr     popa        ; 'ypos'
+        sta     ypos+1
+        tax
+
+        clc
+        adc     ymax+1
+        sta     ymax+1
+
+        jsr     popa        ; 'xpos'
+        sta     xpos+1
+
+        clc
+        adc     xmax+1
+        sta     xmax+1
+yloop:
+        lda     BASELO,x
+        sta     src+1
+        basehi
+        sta     src+2
+
+xpos:   ldx     #$FF        ; Patched
+xloop:
+src:    lda     $FFFF,x     ; Patched
+dst:    sta     $FFFF,y     ; Patched
+        iny
+        inx
+xmax:   cpx     #$FF        ; Patched
+        bne     xloop
+
+        inc     ypos+1
+ypos:   ldx     #$FF        ; Patched
+ymax:   cpx     #$FF        ; Patched
+        bne     yloop
+        rts
+
+.endproc
+
+
+; Draws len glyphs from hires_char_set, one per column from xpos on
+.proc   _hires_text
+
+        stx     rop         ; 'rop' hi
+        sta     rop+1       ; 'rop' lo
+
+        jsr     popa        ; 'len'
+        sta     tmp2
+
+        jsr     popax       ; 'text'
+        sta     text+1
+        stx     text+2
+
+        jsr     popa        ; 'ypos'
+        sta     ypos+1
+
+        jsr     popa        ; 'xpos'
+        sta     tmp1
+
+.ifdef HIRES_PAGE_FLIP
+        lda     tmp2        ; Nothing drawn, so nothing to mark
+        beq     :+
+        lda     ypos+1
+        tax
+        clc
+        adc     #7
+        sta     dirty_y1
+        lda     tmp1
+        sta     dirty_x0
+        clc
+        adc     tmp2
+        sta     dirty_x1
+        jsr     mark_dirty
+:
+.endif
+
+        ldy     #$00
+        sty     tmp3        ; index into text
+cloop:
+        ldy     tmp3
+        cpy     tmp2
+        beq     done
+text:   lda     $FFFF,y     ; Patched
+        iny
+        sty     tmp3
+
+        sec
+        sbc     #' '        ; Char set starts at space
+        ldx     #$00
+        stx     ptr1+1
+        asl                 ; 8 bytes per glyph
+        rol     ptr1+1
+        asl
+        rol     ptr1+1
+        asl
+        rol     ptr1+1
+        clc
+        adc     #<_hires_char_set
+        sta     src+1
+        lda     ptr1+1
+        adc     #>_hires_char_set
+        sta     src+2
+
+ypos:   ldx     #$FF        ; Patched
+        ldy     #$00
+yloop:
+        lda     BASELO,x    ; A row never crosses a page
+        clc
+        adc     tmp1
+        sta     dst+1
+        basehi
+        sta     dst+2
+
+src:    lda     $FFFF,y     ; Patched
+rop:    nop                 ; Patched
+        nop                 ; Patched
+dst:    sta     $FFFF       ; Patched
+        inx
+        iny
+        cpy     #7          ; Like plat_draw_char, the last row isn't drawn
+        bne     yloop
+
+        inc     tmp1
+        bne     cloop       ; Always
+done:
+        rts
+
+.endproc
+
+
+; Show the page that was drawn to and draw to the other one from now on.
+; The rows changed since the last flip are copied across first, so both
+; pages show the same.  Does nothing unless built with HIRES_PAGE_FLIP
+.proc   _hires_flip
+
+.ifdef HIRES_PAGE_FLIP
+        lda     changed
+        beq     done
+        lda     #$00
+        sta     changed
+
+        lda     back
+        beq     :+
+        bit     $C055       ; Show page 2
+        jmp     flip
+:       bit     $C054       ; Show page 1
+flip:   eor     #$60
+        sta     back
+
+        ldx     #$00
+row:    lda     DIRTYHI,x
+        beq     next        ; Nothing drawn in this row
+        sta     xmax+1
+        cmp     DIRTYLO,x
+        beq     clear       ; An empty span, which would copy 256 bytes
+        bcc     clear
+        lda     BASELO,x
+        sta     src+1
+        sta     dst+1
+        lda     BASEHI,x
+        eor     back
+        sta     dst+2       ; Page now drawn to
+        eor     #$60
+        sta     src+2       ; Page now showing
+
+        ldy     DIRTYLO,x
+xloop:
+src:    lda     $FFFF,y     ; Patched
+dst:    sta     $FFFF,y     ; Patched
+        iny
+xmax:   cpy     #$FF        ; Patched
+        bne     xloop
+
+clear:  lda     #$FF
+        sta     DIRTYLO,x
+        lda     #$00
+        sta     DIRTYHI,x
+next:   inx
+        cpx     #$C0
+        bne     row
+done:
+.endif
+        rts
+
+.endproc
+
+
+.ifdef HIRES_PAGE_FLIP
+
+back:   .byte   $00         ; Page drawn to, $00 or $60 added to BASEHI
+ready:  .byte   $00         ; Page 2 set up by hires_init
+changed:
+        .byte   $00         ; Something was drawn since the last flip
+dirty_y1:
+        .byte   $00
+dirty_x0:
+        .byte   $00
+dirty_x1:
+        .byte   $00
+
+; Widen the dirty spans of rows X up to dirty_y1 to take in columns
+; dirty_x0 up to dirty_x1.  Keeps X and Y
+.proc   mark_dirty
+
+        stx     first+1
+        lda     #$01
+        sta     changed
+loop:
+        lda     dirty_x0
+        cmp     DIRTYLO,x
+        bcs     :+
+        sta     DIRTYLO,x
+:       lda     dirty_x1
+        cmp     DIRTYHI,x
+        bcc     :+
+        sta     DIRTYHI,x
+:       inx
+        cpx     dirty_y1
+        bne     loop
+first:  ldx     #$FF        ; Patched
+        rts
+
+.endproc
+
+.endif
@@ -38,18 +38,38 @@
 #define ROP_INV                 0x49FF
 #define ROP_AND(val)            0x2900|(val)
 
+// Pixels under a menu are kept here so erasing the menu is a copy back.
+// Big enough for the in-game menu; larger menus redraw what they covered
+#define SAVE_UNDER_SIZE         (20 * 10 * CHARACTER_HEIGHT)
+#define SAVE_UNDER_NONE         0   // No menu on screen
+#define SAVE_UNDER_VALID        1   // save_under holds what the menu covers
+#define SAVE_UNDER_STALE        2   // Menu on screen but save_under is not usable
+
 extern char hires_char_set[96][CHARACTER_HEIGHT];
-extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+// Pre-composited squares: the empty square, then each piece in black and
+// in white.  Each on a dark [0] and on a light [1] square
+#define TILE_EMPTY              0
+#define TILE_PIECE(type, side)  (((type) << 1) - 1 + (side))
+extern char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
 
 void hires_init(void);
 void hires_done(void);
-void hires_text(char flag);
+void hires_flip(void);
 void hires_draw(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop, char *src);
+void hires_copy(char xpos,    char ypos,
+                char xsize,   char ysize,
+                char *src);
 void hires_mask(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop);
+void hires_save(char xpos,    char ypos,
+                char xsize,   char ysize,
+                char *dst);
+void hires_text(char xpos,    char ypos,
+                const char *text, char len,
+                unsigned rop);
 
 
 typedef struct _apple2 {
@@ -59,9 +79,10 @@ typedef struct _apple2 {
     uint8_t *help_text_len[2];
     uint8_t help_text_num_lines[2];
     uint8_t terminal_display_width;
-    char send_buffer[80];
     char terminal_log_buffer[80 * 23];
     char status_log_buffer[13 * 24];
+    uint8_t save_under_state;
+    char save_under[SAVE_UNDER_SIZE];
 } apple2_t;
 
 extern apple2_t apple2;
@@ -142,6 +142,8 @@ uint8_t plat_core_key_input(input_event_t *evt) {
 
 /*-----------------------------------------------------------------------*/
 void plat_core_key_wait_any() {
+    // Make sure what was drawn is showing
+    plat_draw_update();
     while (kbhit()) {
         cgetc();
     }
@@ -123,6 +123,24 @@ apple2_t apple2 = {
     SCREEN_TEXT_WIDTH, // terminal_display_width
 };
 
+// Where each square on screen is drawn, from the top left, and whether it
+// is a light square.  Looked up with position ^ global.view.flip
+#define SQUARE_ROW_X            2, 5, 8, 11, 14, 17, 20, 23
+#define SQUARE_ROW_Y(y)         y, y, y, y, y, y, y, y
+#define SQUARE_ROW_LIGHT(l)     l, !l, l, !l, l, !l, l, !l
+static const uint8_t square_x[64] = {
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+};
+static const uint8_t square_y[64] = {
+    SQUARE_ROW_Y(2),   SQUARE_ROW_Y(24),  SQUARE_ROW_Y(46),  SQUARE_ROW_Y(68),
+    SQUARE_ROW_Y(90),  SQUARE_ROW_Y(112), SQUARE_ROW_Y(134), SQUARE_ROW_Y(156),
+};
+static const bool square_light[64] = {
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+};
+
 
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
@@ -130,11 +148,90 @@ static void plat_draw_char(char x, char y, unsigned rop, char c) {
     hires_draw(x, y, 1, 7, rop, hires_char_set[c - ' ']);
 }
 
+/*-----------------------------------------------------------------------*/
+// XOR a marker onto a square, so drawing it again takes it off
+static void plat_draw_marker(uint8_t position, uint8_t marker) {
+    uint8_t x, y;
+
+    if (position == MARKER_NONE) {
+        return;
+    }
+    position ^= global.view.flip;
+    x = square_x[position];
+    y = square_y[position];
+    if (marker == MARKER_CURSOR) {
+        hires_mask(x, y + SQUARE_DISPLAY_HEIGHT/3, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT/2-2, ROP_INV);
+    } else {
+        hires_mask(x, y, 1, SQUARE_DISPLAY_HEIGHT, ROP_XOR(apple2.rop_line[0][2]));
+        hires_mask(x + SQUARE_TEXT_WIDTH - 1, y, 1, SQUARE_DISPLAY_HEIGHT, ROP_XOR(apple2.rop_line[1][2]));
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Copy the menu rectangle to (or back from) save_under.  The hires routines
+// index the buffer with an 8 bit register, so it's done in 256 byte bands
+static void plat_draw_save_under_copy(bool restore) {
+    uint8_t y, end, rows, step;
+    char *buffer = apple2.save_under;
+
+    step = 256 / global.view.mc.w;
+    y = global.view.mc.y * CHARACTER_HEIGHT;
+    end = y + global.view.mc.h * CHARACTER_HEIGHT;
+    while (y < end) {
+        rows = end - y;
+        if (rows > step) {
+            rows = step;
+        }
+        if (restore) {
+            // ROP_XOR(0) as ROP_CPY would also set the palette bit
+            hires_draw(global.view.mc.x, y, global.view.mc.w, rows, ROP_XOR(0), buffer);
+        } else {
+            hires_save(global.view.mc.x, y, global.view.mc.w, rows, buffer);
+        }
+        buffer += rows * global.view.mc.w;
+        y += rows;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Something was drawn at x, y (columns, pixels) while a menu is up.  Copy the
+// part of it the menu will cover into save_under, a row at a time, before
+// the menu is drawn back over it
+static void plat_draw_save_under_patch(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    uint8_t l, t, r, b;
+    char *buffer;
+
+    if (apple2.save_under_state != SAVE_UNDER_VALID) {
+        return;
+    }
+    l = MAX(x, global.view.mc.x);
+    r = MIN(x + w, global.view.mc.x + global.view.mc.w);
+    t = MAX(y, global.view.mc.y * CHARACTER_HEIGHT);
+    b = MIN(y + h, (global.view.mc.y + global.view.mc.h) * CHARACTER_HEIGHT);
+    if (l >= r || t >= b) {
+        return;
+    }
+    buffer = apple2.save_under + (t - global.view.mc.y * CHARACTER_HEIGHT) * global.view.mc.w + (l - global.view.mc.x);
+    for (; t < b; ++t) {
+        hires_save(l, t, r - l, 1, buffer);
+        buffer += global.view.mc.w;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 // Restore the background that a menu covered up
 void plat_draw_background() {
     uint8_t t, l, b, r, mt, mb, mw;
     int8_t i, x, y;
+
+    // Put back the pixels the menu covered, if nothing changed under it
+    if (apple2.save_under_state == SAVE_UNDER_VALID) {
+        plat_draw_save_under_copy(true);
+        apple2.save_under_state = SAVE_UNDER_NONE;
+        return;
+    }
+    apple2.save_under_state = SAVE_UNDER_NONE;
+
     mw = global.view.mc.x + global.view.mc.w;
     mt = global.view.mc.y << 3;
     mb = mt + (global.view.mc.h << 3);
@@ -149,6 +246,7 @@ void plat_draw_background() {
     if (x > 0) {
         // The menu covers part of the status area - clear it
         hires_mask(r, global.view.mc.y * CHARACTER_HEIGHT, x, global.view.mc.h  * CHARACTER_HEIGHT, ROP_BLACK);
+        log_invalidate(&global.view.info_panel);
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
 
@@ -168,7 +266,7 @@ void plat_draw_background() {
             for(x = 0; x < 8; x++) {
                             // Intersect?
                 if(l < mw && r > global.view.mc.x) {
-                    plat_draw_square(i+x);
+                    plat_draw_square((i + x) ^ global.view.flip);
                 }
                 l += SQUARE_TEXT_WIDTH;
                 r += SQUARE_TEXT_WIDTH;
@@ -191,10 +289,10 @@ void plat_draw_board_accoutrements() {
     hires_mask(2, 0, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
     hires_mask(2, 178, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
 
-    // Add the A..H and 1..8 tile-keys
+    // Add the A..H and 1..8 tile-keys, H..A and 8..1 on a flipped board
     for (i = 0; i < 8; ++i) {
-        plat_draw_char(3 + i * SQUARE_TEXT_WIDTH, 184, ROP_CPY, i + 'A');
-        plat_draw_char(0, SCREEN_DISPLAY_HEIGHT - 29 - i * SQUARE_DISPLAY_HEIGHT, ROP_CPY, i + '1');
+        plat_draw_char(3 + i * SQUARE_TEXT_WIDTH, 184, ROP_CPY, (i ^ (global.view.flip & 7)) + 'A');
+        plat_draw_char(0, SCREEN_DISPLAY_HEIGHT - 29 - i * SQUARE_DISPLAY_HEIGHT, ROP_CPY, (i ^ (global.view.flip & 7)) + '1');
     }
 }
 
@@ -202,6 +300,10 @@ void plat_draw_board_accoutrements() {
 // Draw the chess board and possibly clear the log section
 void plat_draw_board() {
     char i;
+    // Too much to copy in piece by piece, so the erase redraws instead
+    if (apple2.save_under_state == SAVE_UNDER_VALID) {
+        apple2.save_under_state = SAVE_UNDER_STALE;
+    }
     plat_draw_board_accoutrements();
     for (i = 0; i < 64; ++i) {
         plat_draw_square(i);
@@ -223,38 +325,27 @@ void plat_draw_clear_statslog_area(uint8_t row) {
     hires_mask(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
                global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row),
                ROP_BLACK);
+    plat_draw_save_under_patch(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
+                               global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row));
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_clrscr() {
     clrscr();
     hires_mask(0, 0, SCREEN_TEXT_WIDTH, SCREEN_DISPLAY_HEIGHT, ROP_BLACK);
-}
-
-/*-----------------------------------------------------------------------*/
-void plat_draw_highlight(uint8_t position, uint8_t color) {
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-    bool black_or_white = !((x & 1) ^ (y & 1));
-
-    if (color) {
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT + SQUARE_DISPLAY_HEIGHT/3, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT/2-2, ROP_INV);
-    } else {
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT, 1, SQUARE_DISPLAY_HEIGHT, ROP_CONST(apple2.rop_line[black_or_white ? 1 : 0][2]));
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH + SQUARE_TEXT_WIDTH - 1, 2 + y * SQUARE_DISPLAY_HEIGHT, 1, SQUARE_DISPLAY_HEIGHT, ROP_CONST(apple2.rop_line[black_or_white ? 0 : 1][2]));
+    // Anything kept from under a menu is gone
+    if (apple2.save_under_state == SAVE_UNDER_VALID) {
+        apple2.save_under_state = SAVE_UNDER_STALE;
     }
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i, len;
+    uint8_t offset = 0;
+    uint8_t row = log->size >= log->rows ? log->head : 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     if (width > apple2.terminal_display_width) {
@@ -264,16 +355,44 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        offset = 20 * shift;
     }
 
-    for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
+    // Only rows that changed, and only as far as there's text, or as far as
+    // the text that was there before, which the padding spaces then erase
+    for (i = 0; i < log->size; ++i, ++y) {
+        if (log->dirty[i]) {
+            len = log->used[row] > offset ? log->used[row] - offset : 0;
+            if (len > width) {
+                len = width;
+            }
+            len = MIN(MAX(len, log->shown[i]), width);
+            plat_draw_text(x, y, log->buffer + row * log->cols + offset, len);
+            if (!global.view.terminal_active) {
+                plat_draw_save_under_patch(x, y * CHARACTER_HEIGHT, len, CHARACTER_HEIGHT);
+            }
+            log->shown[i] = len;
+        }
+        if (++row >= log->rows) {
+            row = 0;
         }
     }
+    memset(log->dirty, 0, sizeof(log->dirty));
+}
+
+/*-----------------------------------------------------------------------*/
+// The Apple II has no sprites, so the markers are XOR'd on and off
+void plat_draw_markers(uint8_t cursor, uint8_t selected) {
+    if (cursor != global.state.markers[MARKER_CURSOR]) {
+        plat_draw_marker(global.state.markers[MARKER_CURSOR], MARKER_CURSOR);
+        global.state.markers[MARKER_CURSOR] = cursor;
+        plat_draw_marker(cursor, MARKER_CURSOR);
+    }
+    if (selected != global.state.markers[MARKER_SELECTED]) {
+        plat_draw_marker(global.state.markers[MARKER_SELECTED], MARKER_SELECTED);
+        global.state.markers[MARKER_SELECTED] = selected;
+        plat_draw_marker(selected, MARKER_SELECTED);
+    }
 }
 
 /*-----------------------------------------------------------------------*/
@@ -281,6 +400,22 @@ void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
     hires_mask(x, y * CHARACTER_HEIGHT, w, h * CHARACTER_HEIGHT, color ? ROP_WHITE : ROP_BLACK);
 }
 
+/*-----------------------------------------------------------------------*/
+// Called as a menu is drawn in full.  Keep what it's about to cover.  If the
+// menu is already up, save_under still holds what's under it, as whatever
+// was drawn there since was copied in as it was drawn
+void plat_draw_save_under() {
+    if (apple2.save_under_state != SAVE_UNDER_NONE) {
+        return;
+    }
+    if (global.view.mc.w * global.view.mc.h * CHARACTER_HEIGHT > SAVE_UNDER_SIZE) {
+        apple2.save_under_state = SAVE_UNDER_STALE;
+        return;
+    }
+    plat_draw_save_under_copy(false);
+    apple2.save_under_state = SAVE_UNDER_VALID;
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_draw_set_color(uint8_t) {
 }
@@ -304,25 +439,25 @@ void plat_draw_splash_screen() {
 /*-----------------------------------------------------------------------*/
 // Draw a tile with background and piece on it for positions 0..63
 void plat_draw_square(uint8_t position) {
-    unsigned rop;
-    uint8_t inv;
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-    uint8_t piece = fics_letter_to_piece(global.state.chess_board[position]);
-    bool black_or_white = !((x & 1) ^ (y & 1));
-
-    if (piece) {
-        rop = black_or_white ? ROP_INV : ROP_CPY;
-        inv = black_or_white ^ !((piece & PIECE_WHITE) == 0);
-    } else {
-        rop = black_or_white ? ROP_WHITE : ROP_BLACK;
-        inv = 0;
-        piece = 1;
-    }
+    uint8_t tile;
+    uint8_t square = position ^ global.view.flip;
+    uint8_t piece = global.state.chess_board[position];
 
-    hires_draw(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT,
-               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT, rop,
-               hires_pieces[(piece & 127) - 1][inv]);
+    global.state.drawn_board[position] = piece;
+
+    tile = piece ? TILE_PIECE(piece & ~PIECE_WHITE, (piece & PIECE_WHITE) ? SIDE_WHITE : SIDE_BLACK) : TILE_EMPTY;
+    hires_copy(square_x[square], square_y[square],
+               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT,
+               hires_tiles[tile][square_light[square]]);
+    plat_draw_save_under_patch(square_x[square], square_y[square], SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT);
+
+    // The tile replaced any marker on this square, so put it back
+    if (position == global.state.markers[MARKER_CURSOR]) {
+        plat_draw_marker(position, MARKER_CURSOR);
+    }
+    if (position == global.state.markers[MARKER_SELECTED]) {
+        plat_draw_marker(position, MARKER_SELECTED);
+    }
 }
 
 
@@ -334,12 +469,7 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
             cputc(*text++);
         }
     } else {
-        y *= CHARACTER_HEIGHT;
-        while (len) {
-            plat_draw_char(x++, y, ROP_CPY, *text);
-            len--;
-            text++;
-        }
+        hires_text(x, y * CHARACTER_HEIGHT, text, len, ROP_CPY);
     }
 }
 
@@ -379,5 +509,9 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_update() {
+    // Show what this pass of the main loop drew (page flip builds only)
+    if (!global.view.terminal_active) {
+        hires_flip();
+    }
 }
 
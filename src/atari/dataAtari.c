@@ -11,8 +11,58 @@
 #include "platAtari.h"
 
 /*-----------------------------------------------------------------------*/
-// Atari specific graphics for the chess pieces
-char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
+// Atari specific graphics for the chess squares, made by genpieces.cpp
+char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
+    {
+        {
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00,
+        },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
     {
         {
             0x00, 0x00, 0x00,
@@ -38,6 +88,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x3F, 0xFF, 0xF8,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xC3, 0x83, 0x87,
+            0xC3, 0x83, 0x87,
+            0xC3, 0x83, 0x87,
+            0xC0, 0x00, 0x07,
+            0xC0, 0x00, 0x07,
+            0xE0, 0x00, 0x0F,
+            0xF0, 0x00, 0x1F,
+            0xF8, 0x00, 0x3F,
+            0xFB, 0xFF, 0xBF,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xF8, 0x00, 0x3F,
+            0xF0, 0x00, 0x1F,
+            0xF0, 0x00, 0x1F,
+            0xEF, 0xFF, 0xEF,
+            0xC0, 0x00, 0x07,
+            0xC0, 0x00, 0x07,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x3C, 0x7C, 0x78,
@@ -62,6 +138,30 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x3F, 0xFF, 0xF8,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xC3, 0x83, 0x87,
+            0xDB, 0xBB, 0xB7,
+            0xDB, 0xBB, 0xB7,
+            0xD8, 0x38, 0x37,
+            0xDF, 0xFF, 0xF7,
+            0xEF, 0xFF, 0xEF,
+            0xF7, 0xFF, 0xDF,
+            0xFA, 0x00, 0xBF,
+            0xF9, 0xFF, 0x3F,
+            0xFD, 0xFF, 0x7F,
+            0xFD, 0xFF, 0x7F,
+            0xFD, 0xFF, 0x7F,
+            0xFD, 0xFF, 0x7F,
+            0xFD, 0xFF, 0x7F,
+            0xFB, 0xFF, 0xBF,
+            0xF7, 0xFF, 0xDF,
+            0xF4, 0x00, 0x5F,
+            0xEF, 0xFF, 0xEF,
+            0xC0, 0x00, 0x07,
+            0xC0, 0x00, 0x07,
+            0xFF, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -88,6 +188,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x07, 0xFF, 0xF8,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0x77, 0xFF,
+            0xFE, 0xAB, 0xFF,
+            0xFC, 0x11, 0xFF,
+            0xFC, 0x00, 0xFF,
+            0xF8, 0x00, 0x7F,
+            0xF8, 0x42, 0x7F,
+            0xF8, 0x02, 0x7F,
+            0xF0, 0x03, 0x3F,
+            0xE0, 0x01, 0x3F,
+            0xC0, 0x00, 0x3F,
+            0xC0, 0x00, 0x3F,
+            0xE1, 0xE1, 0x1F,
+            0xF3, 0xC1, 0x9F,
+            0xFF, 0x80, 0x8F,
+            0xFF, 0x00, 0x4F,
+            0xFE, 0x00, 0x07,
+            0xFC, 0x00, 0x07,
+            0xFB, 0xFF, 0xF7,
+            0xF8, 0x00, 0x07,
+            0xF8, 0x00, 0x07,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x00, 0x88, 0x00,
@@ -112,6 +238,30 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x07, 0xFF, 0xF8,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0x77, 0xFF,
+            0xFE, 0xAB, 0xFF,
+            0xFD, 0xED, 0xFF,
+            0xFD, 0xFE, 0xFF,
+            0xFB, 0xFF, 0x7F,
+            0xFB, 0xBD, 0x7F,
+            0xFB, 0xFD, 0x7F,
+            0xF7, 0xFC, 0xBF,
+            0xEF, 0xFE, 0xBF,
+            0xDF, 0xFF, 0xBF,
+            0xDE, 0x1F, 0xBF,
+            0xED, 0xEE, 0x9F,
+            0xF3, 0xDE, 0x5F,
+            0xFF, 0xBF, 0x6F,
+            0xFF, 0x7F, 0xAF,
+            0xFE, 0xFF, 0xE7,
+            0xFD, 0xFF, 0xF7,
+            0xFA, 0x00, 0x17,
+            0xFB, 0xFF, 0xF7,
+            0xF8, 0x00, 0x07,
+            0xFF, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -138,6 +288,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x1F, 0xFF, 0xF0,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFE, 0x10, 0xFF,
+            0xFC, 0x10, 0x7F,
+            0xFC, 0xFE, 0x7F,
+            0xF8, 0x10, 0x3F,
+            0xF8, 0x10, 0x3F,
+            0xF8, 0x10, 0x3F,
+            0xFC, 0x10, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFE, 0x00, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFC, 0x00, 0x7F,
+            0xF7, 0xFF, 0xDF,
+            0xE0, 0x00, 0x0F,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x00, 0x00, 0x00,
@@ -162,6 +338,30 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x1F, 0xFF, 0xF0,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFE, 0xEE, 0xFF,
+            0xFD, 0xEF, 0x7F,
+            0xFD, 0x01, 0x7F,
+            0xFB, 0xEF, 0xBF,
+            0xFB, 0xEF, 0xBF,
+            0xFB, 0xEF, 0xBF,
+            0xFD, 0xEF, 0x7F,
+            0xFD, 0xFF, 0x7F,
+            0xFE, 0xFE, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFD, 0xFF, 0x7F,
+            0xF0, 0x00, 0x1F,
+            0xE0, 0x00, 0x0F,
+            0xFF, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -188,6 +388,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xF1, 0x83, 0x1F,
+            0xE0, 0xC6, 0x0F,
+            0xC0, 0x82, 0x07,
+            0xC1, 0x01, 0x07,
+            0xC0, 0x00, 0x07,
+            0xC2, 0x10, 0x87,
+            0xC3, 0x39, 0x87,
+            0xE1, 0xFF, 0x0F,
+            0xE0, 0xFE, 0x0F,
+            0xF0, 0x00, 0x1F,
+            0xF0, 0x00, 0x1F,
+            0xF3, 0xFF, 0x9F,
+            0xF8, 0x00, 0x3F,
+            0xF8, 0x00, 0x3F,
+            0xF8, 0x00, 0x3F,
+            0xF8, 0x00, 0x3F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x00, 0x00, 0x00,
@@ -212,6 +438,30 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xF1, 0xBB, 0x1F,
+            0xEE, 0xD6, 0xEF,
+            0xDE, 0xBA, 0xF7,
+            0xDD, 0x7D, 0x77,
+            0xDF, 0xFF, 0xF7,
+            0xDD, 0xEF, 0x77,
+            0xDC, 0xC6, 0x77,
+            0xEE, 0x00, 0xEF,
+            0xEF, 0x01, 0xEF,
+            0xF7, 0xFF, 0xDF,
+            0xF7, 0xFF, 0xDF,
+            0xF4, 0x00, 0x5F,
+            0xFB, 0xFF, 0xBF,
+            0xFB, 0xFF, 0xBF,
+            0xFB, 0xFF, 0xBF,
+            0xF9, 0xFF, 0x3F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -238,6 +488,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xD7, 0xFF,
+            0xFF, 0x11, 0xFF,
+            0xFF, 0x39, 0xFF,
+            0xFC, 0xD6, 0x7F,
+            0xF8, 0x54, 0x3F,
+            0xF0, 0x10, 0x1F,
+            0xE0, 0x38, 0x0F,
+            0xE2, 0x54, 0x8F,
+            0xC4, 0x38, 0x47,
+            0xC4, 0x10, 0x47,
+            0xC2, 0x00, 0x87,
+            0xE1, 0x01, 0x0F,
+            0xE0, 0x82, 0x0F,
+            0xF0, 0x00, 0x1F,
+            0xF3, 0xFF, 0x9F,
+            0xF8, 0x00, 0x3F,
+            0xF8, 0x00, 0x3F,
+            0xF8, 0x00, 0x3F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x00, 0x38, 0x00,
@@ -262,6 +538,30 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xD7, 0xFF,
+            0xFF, 0x11, 0xFF,
+            0xFF, 0x39, 0xFF,
+            0xFC, 0xD6, 0x7F,
+            0xFB, 0x55, 0xBF,
+            0xF7, 0x93, 0xDF,
+            0xEF, 0xD7, 0xEF,
+            0xED, 0xBB, 0x6F,
+            0xDB, 0xD7, 0xB7,
+            0xDB, 0xEF, 0xB7,
+            0xDD, 0xEF, 0x77,
+            0xEE, 0xFE, 0xEF,
+            0xEF, 0x7D, 0xEF,
+            0xF7, 0xFF, 0xDF,
+            0xF6, 0x00, 0xDF,
+            0xFB, 0xFF, 0xBF,
+            0xFB, 0xFF, 0xBF,
+            0xF9, 0xFF, 0x3F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -288,6 +588,32 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x83, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFE, 0xFE, 0xFF,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00,
             0x00, 0x00, 0x00,
@@ -312,5 +638,29 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x03, 0xFF, 0x80,
             0x00, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0x7D, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0xC7, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0x39, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0xBB, 0xFF,
+            0xFF, 0x01, 0xFF,
+            0xFE, 0xFE, 0xFF,
+            0xFC, 0x00, 0x7F,
+            0xFC, 0x00, 0x7F,
+            0xFF, 0xFF, 0xFF,
+        },
     },
 };
@@ -277,40 +277,63 @@ char pieces[]=
 "                        "
 ;
 
+// 3 bytes across and 22 rows per piece, in 2 versions
+#define TILE_SIZE   (3 * 22)
+
+unsigned char images[6][2][TILE_SIZE];
+unsigned char blank[TILE_SIZE];
+
+// Print a piece as it shows on a dark or a light square.  On a light
+// square it's inverted, so the tile can be copied to the screen as is
+void tile(const unsigned char *image, int light)
+{
+    int i;
+
+    printf("        {\n");
+    for(i=0; i<TILE_SIZE; ++i)
+    {
+        if(!(i%3))
+            printf("           ");
+        printf(" 0x%02X,", (unsigned char)(light ? ~image[i] : image[i]));
+        if(i%3 == 2)
+            printf("\n");
+    }
+    printf("        },\n");
+}
+
 int main(void)
 {
-    int i, j, k;
+    int i, j, piece, side;
     unsigned char c = 0;
+    unsigned char *image = &images[0][0][0];
 
-    printf("const char gfxTiles[PAWN][2][66] = \n{\n\t{\n\t\t{\n\t\t\t");
-    for(i=0, j=7, k=0; i<sizeof(pieces); ++i)
+    for(i=0, j=7; i<sizeof(pieces); ++i)
     {
         c |= (pieces[i] == '*') << j--;
         if (j<0)
         {
-            printf("0x%02X, ", c);
-            k++;
-            if(!(k%3))
-                printf("\n\t\t");
+            *image++ = c;
             c = 0;
             j = 7;
-            if(!(k % 66))
-            {
-                printf("},\n");
-                if(!(k % 132))
-                {
-                    printf("\t},\n");
-                    if(k != 66 * 12)
-                        printf("\t{\n");
-                }
-                if(k != 66 * 12)
-                    printf("\t\t{\n\t\t\t");
-            }
-            else
-            {
-                printf("\t");
-            }
-            
+        }
+    }
+
+    // The empty square, then each piece in black and in white.  Every tile
+    // is there for a dark and a light square.  On a light square the other
+    // version of the piece is used, since the tile gets inverted
+    printf("char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {\n");
+    printf("    {\n");
+    tile(blank, 0);
+    tile(blank, 1);
+    printf("    },\n");
+    for(piece=0; piece<6; ++piece)
+    {
+        for(side=0; side<2; ++side)
+        {
+            printf("    {\n");
+            tile(images[piece][side], 0);
+            tile(images[piece][!side], 1);
+            printf("    },\n");
         }
     }
     printf("};\n");
@@ -11,18 +11,27 @@
 .include "atari.inc"
 .include "zeropage.inc"
 
-.export _hires_init, _hires_done, _hires_draw, _hires_mask
+.export _hires_init, _hires_done, _hires_draw, _hires_copy, _hires_mask, _hires_save, _hires_text
+.export _hires_players, _hires_text_row
 .import popa, popax, _hires_piece
 
 
 .segment "SCREENMEM"
 .res 8192
+
+;-----------------------------------------------------------------------
+; Player graphics, 4 players of 128 bytes (double line resolution).  Not
+; cleared at start-up
+.segment "PMG"
+_hires_players:
+.res 4 * 128
 ;-----------------------------------------------------------------------
 ; Display-list related defenitions
 scrn     = $2000                                 ; screen starts here
 scnd     = $3000                                 ; lower part of screen here
 top      = ((scnd - scrn) / $28)                 ; display list entries before scnd (should be $66/102)
 bot      = ($c0-top)                             ; display list entries after scnd  (should be $5a/90) $5a*$28 = $e10 (3600 bytes)
+txt_rows = 8                                     ; scan lines at the bottom shown as a text row instead
 gfx_mode = $0f                                   ; mode to run the screen at GR8/AnticF
 txt_scrn = $3C00                                 ; overlaps GR8!? Also $28*$19=$3e8 gets us to $3C00 + 3e8 = 3fe8 (only 23 b left)
 txt_mode = $02                                   ; mode to run the screen at GR0/Antic2
@@ -30,7 +39,8 @@ txt_mode = $02                                   ; mode to run the screen at GR0
 
 
 ;-----------------------------------------------------------------------
-; Display list - mode 0x0f (320x192, 2 color).
+; Display list - mode 0x0f (320x192, 2 color), with the last 8 lines a
+; row of mode 2 text: the file letters, input line and last status row.
 ; Goes in its own segment so it won't cross a boundry
 .segment "DLIST"
 
@@ -41,9 +51,10 @@ hires_list:
             .byte gfx_mode
         .endrep
         .byte $40 +gfx_mode, <scnd, >scnd        ; clear the 4k boundry and start another row of mode $0x
-        .repeat bot-1                            ; another 96 lines of mode $0x (incl. LMS row above)
+        .repeat bot-txt_rows-1                   ; another 82 lines of mode $0x (incl. LMS row above)
             .byte gfx_mode
         .endrep
+        .byte $40 + txt_mode,<_hires_text_row,>_hires_text_row ; 8 lines of text, in the colors of mode $0x
         .byte $41,<hires_list,>hires_list        ; Vertical Blank jump to start of hires_list
 
 text_list:
@@ -54,6 +65,10 @@ text_list:
         .endrep
         .byte $41,<text_list,>text_list          ; Vertical Blank jump to start of text_list
 
+; The bottom row of the hires screen, in ANTIC internal character codes
+_hires_text_row:
+        .res 40
+
 .rodata
 
 ;-----------------------------------------------------------------------
@@ -169,6 +184,55 @@ ymax:   cpx     #$FF                             ; Patched
 .endproc
 
 
+.proc   _hires_copy
+
+        sta     src+1                            ; 'src' lo
+        stx     src+2                            ; 'src' hi
+
+        jsr     popa                             ; 'ysize'
+        sta     ymax+1
+
+        jsr     popa                             ; 'xsize'
+        sta     xmax+1
+
+        jsr     popa                             ; 'ypos'
+        sta     ypos+1
+        tax
+
+        clc
+        adc     ymax+1
+        sta     ymax+1
+
+        jsr     popa                             ; 'xpos'
+        sta     xpos+1
+
+        clc
+        adc     xmax+1
+        sta     xmax+1
+yloop:
+        lda     BASELO,x
+        sta     dst+1
+        lda     BASEHI,x
+        sta     dst+2
+
+xpos:   ldx     #$FF                             ; Patched
+xloop:
+src:    lda     $FFFF,y                          ; Patched
+        iny
+dst:    sta     $FFFF,x                          ; Patched
+        inx
+xmax:   cpx     #$FF                             ; Patched
+        bne     xloop
+
+        inc     ypos+1
+ypos:   ldx     #$FF                             ; Patched
+ymax:   cpx     #$FF                             ; Patched
+        bne     yloop
+        rts
+
+.endproc
+
+
 .proc   _hires_mask
 
         stx     rop                              ; 'rop' hi
@@ -218,3 +282,129 @@ ymax:   cpx     #$FF                             ; Patched
         rts
 
 .endproc
+
+
+.proc   _hires_save
+
+        sta     dst+1                            ; 'dst' lo
+        stx     dst+2                            ; 'dst' hi
+
+        jsr     popa                             ; 'ysize'
+        sta     ymax+1
+
+        jsr     popa                             ; 'xsize'
+        sta     xmax+1
+
+        jsr     popa                             ; 'ypos'
+        sta     ypos+1
+        tax
+
+        clc
+        adc     ymax+1
+        sta     ymax+1
+
+        jsr     popa                             ; 'xpos'
+        sta     xpos+1
+
+        clc
+        adc     xmax+1
+        sta     xmax+1
+yloop:
+        lda     BASELO,x
+        sta     src+1
+        lda     BASEHI,x
+        sta     src+2
+
+xpos:   ldx     #$FF                             ; Patched
+xloop:
+src:    lda     $FFFF,x                          ; Patched
+dst:    sta     $FFFF,y                          ; Patched
+        iny
+        inx
+xmax:   cpx     #$FF                             ; Patched
+        bne     xloop
+
+        inc     ypos+1
+ypos:   ldx     #$FF                             ; Patched
+ymax:   cpx     #$FF                             ; Patched
+        bne     yloop
+        rts
+
+.endproc
+
+
+; Draws len glyphs from the character set at CHBAS, one per column from xpos on
+.proc   _hires_text
+
+        stx     rop                              ; 'rop' hi
+        sta     rop+1                            ; 'rop' lo
+
+        jsr     popa                             ; 'len'
+        sta     tmp2
+
+        jsr     popax                            ; 'text'
+        sta     text+1
+        stx     text+2
+
+        jsr     popa                             ; 'ypos'
+        sta     ypos+1
+
+        jsr     popa                             ; 'xpos'
+        sta     tmp1
+
+        ldy     #$00
+        sty     tmp3                             ; index into text
+cloop:
+        ldy     tmp3
+        cpy     tmp2
+        beq     done
+text:   lda     $FFFF,y                          ; Patched
+        iny
+        sty     tmp3
+
+        cmp     #'a'                             ; Lowercase is in place, the
+        bcc     :+                               ; rest is 32 lower in the set
+        cmp     #'z'+1
+        bcc     :++
+:       sec
+        sbc     #32
+:       ldx     #$00
+        stx     ptr1+1
+        asl                                      ; 8 bytes per glyph
+        rol     ptr1+1
+        asl
+        rol     ptr1+1
+        asl
+        rol     ptr1+1
+        sta     src+1
+        lda     ptr1+1
+        clc
+        adc     CHBAS                            ; Page of the character set
+        sta     src+2
+
+ypos:   ldx     #$FF                             ; Patched
+        ldy     #$00
+yloop:
+        lda     BASELO,x
+        clc
+        adc     tmp1
+        sta     dst+1
+        lda     BASEHI,x
+        adc     #$00
+        sta     dst+2
+
+src:    lda     $FFFF,y                          ; Patched
+rop:    nop                                      ; Patched
+        nop                                      ; Patched
+dst:    sta     $FFFF                            ; Patched
+        inx
+        iny
+        cpy     #8
+        bne     yloop
+
+        inc     tmp1
+        bne     cloop                            ; Always
+done:
+        rts
+
+.endproc
@@ -32,14 +32,41 @@
 #define ROP_INV                 0x49FF
 #define ROP_AND(val)            0x2900|(val)
 
+// Pixels under a menu are kept here so erasing the menu is a copy back.
+// Big enough for the in-game menu; larger menus redraw what they covered
+#define SAVE_UNDER_SIZE         (20 * 10 * CHARACTER_HEIGHT)
+#define SAVE_UNDER_NONE         0   // No menu on screen
+#define SAVE_UNDER_VALID        1   // save_under holds what the menu covers
+#define SAVE_UNDER_STALE        2   // Menu on screen but save_under is not usable
+
+// The bottom text row is ANTIC character mode, not bitmap.  What's drawn
+// there goes to hires_text_row
+#define TEXT_ROW                (SCREEN_TEXT_HEIGHT - 1)
+
+// The board markers are players 0 (cursor) and 1 (selection), at double
+// line resolution so a byte covers 2 scan lines, and at double width
+#define PLAYER_BOARD_TOP        17  // (32 lines above the bitmap + 2 board frame lines) / 2
+#define PLAYER_BOARD_LEFT       56  // 48 color clocks left of the bitmap + 2 frame bytes of 4
+#define PLAYER_SQUARE_HEIGHT    (SQUARE_DISPLAY_HEIGHT / 2)
+#define PLAYER_SQUARE_WIDTH     (SQUARE_TEXT_WIDTH * 4)
+
 void hires_init(void);
 void hires_done(void);
 void hires_draw(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop, char *src);
+void hires_copy(char xpos,    char ypos,
+                char xsize,   char ysize,
+                char *src);
 void hires_mask(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop);
+void hires_save(char xpos,    char ypos,
+                char xsize,   char ysize,
+                char *dst);
+void hires_text(char xpos,    char ypos,
+                const char *text, char len,
+                unsigned rop);
 
 /*-----------------------------------------------------------------------*/
 typedef struct _atari {
@@ -50,12 +77,24 @@ typedef struct _atari {
     uint8_t help_text_num_lines;
     uint8_t terminal_display_width;
     char *CHAR_ROM;
-    char send_buffer[80];
     char terminal_log_buffer[80 * 23];
     char status_log_buffer[13 * 24];
+    uint8_t save_under_state;
+    char save_under[SAVE_UNDER_SIZE];
 } atari_t;
 
 extern atari_t atari;
-extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+// Pre-composited squares: the empty square, then each piece in black and
+// in white.  Each on a dark [0] and on a light [1] square
+#define TILE_EMPTY              0
+#define TILE_PIECE(type, side)  (((type) << 1) - 1 + (side))
+extern char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+extern char hires_players[4][128];
+extern char hires_text_row[SCREEN_TEXT_WIDTH];
+
+// Set by net_proceed, the FujiNet PROCEED interrupt handler, when the
+// network device has something for plat_net_update
+extern uint8_t net_data_ready;
+void net_proceed(void);
 
 #endif //_PLATATARI_H_
@@ -22,12 +22,17 @@ void plat_core_active_term(bool active) {
     if (active) {
         hires_done();
         clrscr();
+        // Move the markers off the screen
+        GTIA_WRITE.hposp0 = 0;
+        GTIA_WRITE.hposp1 = 0;
         global.view.terminal_active = 1;
     } else {
         clrscr();
         hires_init();
         plat_draw_board();
+        plat_draw_markers(global.state.markers[MARKER_CURSOR], global.state.markers[MARKER_SELECTED]);
         global.view.terminal_active = 0;
+        log_invalidate(&global.view.info_panel);
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
 }
@@ -73,6 +78,20 @@ void plat_core_init() {
     _setcolor(2, 0xc, 0x7);  // Pixel %0 color
     _setcolor(4, 0xC, 0x7);  // border color
 
+    // Players 0 and 1 are the board markers, 2 and 3 stay off screen
+    memset(hires_players, 0, sizeof(hires_players));
+    ANTIC.pmbase = ((unsigned)hires_players - 0x200) >> 8;
+    GTIA_WRITE.sizep0 = 1;   // Double width
+    GTIA_WRITE.sizep1 = 1;
+    GTIA_WRITE.hposp0 = 0;
+    GTIA_WRITE.hposp1 = 0;
+    GTIA_WRITE.hposp2 = 0;
+    GTIA_WRITE.hposp3 = 0;
+    OS.pcolr0 = 0x86;       // Cursor
+    OS.pcolr1 = 0x46;       // Selection
+    OS.sdmctl = 0x2A;       // Display list, player DMA, normal playfield
+    GTIA_WRITE.gractl = 2;  // Players on
+
     plat_draw_splash_screen();
 
     // Fill in the help text lengths
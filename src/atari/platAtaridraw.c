@@ -7,6 +7,7 @@
  *
  */
 
+#include <atari.h>
 #include <conio.h>
 #include <string.h>
 
@@ -27,6 +28,29 @@ uint8_t plat_mc2pc[9] = {
     0,  // MENU_COLOR_DISABLED
 };
 
+// Where each square on screen is drawn, from the top left, and whether it
+// is a light square.  Looked up with position ^ global.view.flip
+#define SQUARE_ROW_X            2, 5, 8, 11, 14, 17, 20, 23
+#define SQUARE_ROW_Y(y)         y, y, y, y, y, y, y, y
+#define SQUARE_ROW_LIGHT(l)     l, !l, l, !l, l, !l, l, !l
+static const uint8_t square_x[64] = {
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+};
+static const uint8_t square_y[64] = {
+    SQUARE_ROW_Y(2),   SQUARE_ROW_Y(24),  SQUARE_ROW_Y(46),  SQUARE_ROW_Y(68),
+    SQUARE_ROW_Y(90),  SQUARE_ROW_Y(112), SQUARE_ROW_Y(134), SQUARE_ROW_Y(156),
+};
+static const bool square_light[64] = {
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+};
+
+// A frame around a square, as a double width player
+static const char plat_marker_shape[PLAYER_SQUARE_HEIGHT] = {
+    0xFC, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0xFC,
+};
+
 char *help_text[] = {
     "            RetroMate",
     "",
@@ -83,26 +107,137 @@ atari_t atari = {
 };
 
 
+/*-----------------------------------------------------------------------*/
+// Put text in the character mode row, as ANTIC internal codes
+static void plat_draw_text_row(uint8_t x, const char *text, uint8_t len) {
+    char c;
+    char *dst = hires_text_row + x;
+
+    while (len--) {
+        c = *text++;
+        if ((c & 0x7F) < 0x20) {
+            c += 0x40;
+        } else if ((c & 0x7F) < 0x60) {
+            c -= 0x20;
+        }
+        *dst++ = c;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
 static void plat_draw_char(char x, char y, unsigned rop, char c) {
+    if (y == TEXT_ROW * CHARACTER_HEIGHT) {
+        plat_draw_text_row(x, &c, 1);
+        return;
+    }
     if (c < 'a' || c > 'z') {
         c -= 32;
     }
     hires_draw(x, y, 1, 8, rop, atari.CHAR_ROM + c * 8);
 }
 
+/*-----------------------------------------------------------------------*/
+// Put a marker's player on a square, or off the screen for MARKER_NONE.
+// Moving along a row is only a change of horizontal position
+static void plat_draw_player(uint8_t marker, uint8_t position) {
+    uint8_t old = global.state.markers[marker];
+    char *player = hires_players[marker] + PLAYER_BOARD_TOP;
+
+    global.state.markers[marker] = position;
+    // From here on, squares as shown
+    if (old != MARKER_NONE) {
+        old ^= global.view.flip;
+    }
+    if (position != MARKER_NONE) {
+        position ^= global.view.flip;
+    }
+    if (old / 8 != position / 8) {
+        if (old != MARKER_NONE) {
+            memset(player + (old / 8) * PLAYER_SQUARE_HEIGHT, 0, PLAYER_SQUARE_HEIGHT);
+        }
+        if (position != MARKER_NONE) {
+            memcpy(player + (position / 8) * PLAYER_SQUARE_HEIGHT, plat_marker_shape, PLAYER_SQUARE_HEIGHT);
+        }
+    }
+    (&GTIA_WRITE.hposp0)[marker] = position == MARKER_NONE ? 0 : PLAYER_BOARD_LEFT + (position & 7) * PLAYER_SQUARE_WIDTH;
+}
+
+/*-----------------------------------------------------------------------*/
+// Copy the menu rectangle to (or back from) save_under.  The hires routines
+// index the buffer with an 8 bit register, so it's done in 256 byte bands
+static void plat_draw_save_under_copy(bool restore) {
+    uint8_t y, end, rows, step;
+    char *buffer = atari.save_under;
+
+    step = 256 / global.view.mc.w;
+    y = global.view.mc.y * CHARACTER_HEIGHT;
+    end = y + global.view.mc.h * CHARACTER_HEIGHT;
+    while (y < end) {
+        rows = end - y;
+        if (rows > step) {
+            rows = step;
+        }
+        if (restore) {
+            hires_draw(global.view.mc.x, y, global.view.mc.w, rows, ROP_CPY, buffer);
+        } else {
+            hires_save(global.view.mc.x, y, global.view.mc.w, rows, buffer);
+        }
+        buffer += rows * global.view.mc.w;
+        y += rows;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Something was drawn at x, y (columns, pixels) while a menu is up.  Copy the
+// part of it the menu will cover into save_under, a row at a time, before
+// the menu is drawn back over it
+static void plat_draw_save_under_patch(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    uint8_t l, t, r, b;
+    char *buffer;
+
+    if (atari.save_under_state != SAVE_UNDER_VALID) {
+        return;
+    }
+    l = MAX(x, global.view.mc.x);
+    r = MIN(x + w, global.view.mc.x + global.view.mc.w);
+    t = MAX(y, global.view.mc.y * CHARACTER_HEIGHT);
+    b = MIN(y + h, (global.view.mc.y + global.view.mc.h) * CHARACTER_HEIGHT);
+    if (l >= r || t >= b) {
+        return;
+    }
+    buffer = atari.save_under + (t - global.view.mc.y * CHARACTER_HEIGHT) * global.view.mc.w + (l - global.view.mc.x);
+    for (; t < b; ++t) {
+        hires_save(l, t, r - l, 1, buffer);
+        buffer += global.view.mc.w;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 // Restore the background that a menu covered up
 void plat_draw_background() {
     uint8_t t, l, b, r, mt, mb, mw;
     int8_t i, x, y;
+
+    // Put back the pixels the menu covered, if nothing changed under it
+    if (atari.save_under_state == SAVE_UNDER_VALID) {
+        plat_draw_save_under_copy(true);
+        atari.save_under_state = SAVE_UNDER_NONE;
+        return;
+    }
+    atari.save_under_state = SAVE_UNDER_NONE;
+
     mw = global.view.mc.x + global.view.mc.w;
     mt = global.view.mc.y << 3;
     mb = mt + (global.view.mc.h << 3);
     r = plat_core_get_status_x() - 1;
     x = mw - r;
 
+    // The text row is redrawn below, if the menu reached it
+    if (global.view.mc.y + global.view.mc.h > TEXT_ROW) {
+        memset(hires_text_row + global.view.mc.x, 0, global.view.mc.w);
+    }
+
     // If the accoutrements are covered
     if (global.view.mc.x < 2) {
         hires_mask(0, 0, 2, SCREEN_DISPLAY_HEIGHT, ROP_BLACK);
@@ -111,6 +246,7 @@ void plat_draw_background() {
     if (x > 0) {
         // The menu covers part of the status area - clear it
         hires_mask(r, global.view.mc.y * CHARACTER_HEIGHT, x, global.view.mc.h  * CHARACTER_HEIGHT, ROP_BLACK);
+        log_invalidate(&global.view.info_panel);
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
 
@@ -130,7 +266,7 @@ void plat_draw_background() {
             for(x = 0; x < 8; x++) {
                             // Intersect?
                 if(l < mw && r > global.view.mc.x) {
-                    plat_draw_square(i+x);
+                    plat_draw_square((i + x) ^ global.view.flip);
 
                 }
                 l += SQUARE_TEXT_WIDTH;
@@ -154,10 +290,10 @@ void plat_draw_board_accoutrements() {
     hires_mask(2, 0, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
     hires_mask(2, 178, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
 
-    // Add the A..H and 1..8 tile-keys
+    // Add the A..H and 1..8 tile-keys, H..A and 8..1 on a flipped board
     for (i = 0; i < 8; ++i) {
-        plat_draw_char(3 + i * SQUARE_TEXT_WIDTH, 184, ROP_CPY, i + 'A');
-        plat_draw_char(0, SCREEN_DISPLAY_HEIGHT - 29 - i * SQUARE_DISPLAY_HEIGHT, ROP_CPY, i + '1');
+        plat_draw_char(3 + i * SQUARE_TEXT_WIDTH, 184, ROP_CPY, (i ^ (global.view.flip & 7)) + 'A');
+        plat_draw_char(0, SCREEN_DISPLAY_HEIGHT - 29 - i * SQUARE_DISPLAY_HEIGHT, ROP_CPY, (i ^ (global.view.flip & 7)) + '1');
     }
 }
 
@@ -165,6 +301,10 @@ void plat_draw_board_accoutrements() {
 // Draw the chess board and possibly clear the log section
 void plat_draw_board() {
     char i;
+    // Too much to copy in piece by piece, so the erase redraws instead
+    if (atari.save_under_state == SAVE_UNDER_VALID) {
+        atari.save_under_state = SAVE_UNDER_STALE;
+    }
     plat_draw_board_accoutrements();
     for (i = 0; i < 64; ++i) {
         plat_draw_square(i);
@@ -177,47 +317,39 @@ void plat_draw_clear_input_line(bool) {
     if (global.view.terminal_active) {
         cclearxy(0, SCREEN_TEXT_HEIGHT - 1, atari.terminal_display_width);
     } else {
-        hires_mask(0, (SCREEN_TEXT_HEIGHT - 1) * CHARACTER_HEIGHT, SCREEN_TEXT_WIDTH, CHARACTER_HEIGHT, ROP_BLACK);
+        memset(hires_text_row, 0, SCREEN_TEXT_WIDTH);
     }
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_clear_statslog_area(uint8_t row) {
-    hires_mask(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
-               global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row),
-               ROP_BLACK);
+    if (row < TEXT_ROW) {
+        hires_mask(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
+                   global.view.info_panel.cols, CHARACTER_HEIGHT * (TEXT_ROW - row),
+                   ROP_BLACK);
+        plat_draw_save_under_patch(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
+                                   global.view.info_panel.cols, CHARACTER_HEIGHT * (TEXT_ROW - row));
+    }
+    memset(hires_text_row + plat_core_get_status_x(), 0, global.view.info_panel.cols);
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_clrscr() {
-    hires_mask(0, 0, SCREEN_TEXT_WIDTH, SCREEN_DISPLAY_HEIGHT, ROP_BLACK);
-}
-
-/*-----------------------------------------------------------------------*/
-void plat_draw_highlight(uint8_t position, uint8_t color) {
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-    bool black_or_white = !((x & 1) ^ (y & 1));
-
-    if (color) {
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT + SQUARE_DISPLAY_HEIGHT/3, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT/2-2, ROP_INV);
-    } else {
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT, 1, SQUARE_DISPLAY_HEIGHT, ROP_CONST(atari.rop_line[black_or_white ? 1 : 0][4]));
-        hires_mask(2 + x * SQUARE_TEXT_WIDTH + SQUARE_TEXT_WIDTH - 1, 2 + y * SQUARE_DISPLAY_HEIGHT, 1, SQUARE_DISPLAY_HEIGHT, ROP_CONST(atari.rop_line[black_or_white ? 0 : 1][4]));
+    hires_mask(0, 0, SCREEN_TEXT_WIDTH, TEXT_ROW * CHARACTER_HEIGHT, ROP_BLACK);
+    memset(hires_text_row, 0, SCREEN_TEXT_WIDTH);
+    // Anything kept from under a menu is gone
+    if (atari.save_under_state == SAVE_UNDER_VALID) {
+        atari.save_under_state = SAVE_UNDER_STALE;
     }
 }
 
-
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i, len;
+    uint8_t offset = 0;
+    uint8_t row = log->size >= log->rows ? log->head : 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     if (width > atari.terminal_display_width) {
@@ -227,21 +359,64 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        offset = 20 * shift;
     }
 
-    for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
+    // Only rows that changed, and only as far as there's text, or as far as
+    // the text that was there before, which the padding spaces then erase
+    for (i = 0; i < log->size; ++i, ++y) {
+        if (log->dirty[i]) {
+            len = log->used[row] > offset ? log->used[row] - offset : 0;
+            if (len > width) {
+                len = width;
+            }
+            len = MIN(MAX(len, log->shown[i]), width);
+            plat_draw_text(x, y, log->buffer + row * log->cols + offset, len);
+            if (!global.view.terminal_active) {
+                plat_draw_save_under_patch(x, y * CHARACTER_HEIGHT, len, CHARACTER_HEIGHT);
+            }
+            log->shown[i] = len;
+        }
+        if (++row >= log->rows) {
+            row = 0;
         }
     }
+    memset(log->dirty, 0, sizeof(log->dirty));
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_markers(uint8_t cursor, uint8_t selected) {
+    plat_draw_player(MARKER_CURSOR, cursor);
+    plat_draw_player(MARKER_SELECTED, selected);
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
-    hires_mask(x, y * CHARACTER_HEIGHT, w, h * CHARACTER_HEIGHT, color ? ROP_WHITE : ROP_BLACK);
+    if (y + h > TEXT_ROW) {
+        // Inverse or plain spaces
+        memset(hires_text_row + x, color ? 0x80 : 0, w);
+        h = TEXT_ROW - y;
+    }
+    if (h) {
+        hires_mask(x, y * CHARACTER_HEIGHT, w, h * CHARACTER_HEIGHT, color ? ROP_WHITE : ROP_BLACK);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Called as a menu is drawn in full.  Keep what it's about to cover.  If the
+// menu is already up, save_under still holds what's under it, as whatever
+// was drawn there since was copied in as it was drawn
+void plat_draw_save_under() {
+    if (atari.save_under_state != SAVE_UNDER_NONE) {
+        return;
+    }
+    if (global.view.mc.w * global.view.mc.h * CHARACTER_HEIGHT > SAVE_UNDER_SIZE ||
+            global.view.mc.y + global.view.mc.h > TEXT_ROW) {
+        atari.save_under_state = SAVE_UNDER_STALE;
+        return;
+    }
+    plat_draw_save_under_copy(false);
+    atari.save_under_state = SAVE_UNDER_VALID;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -269,12 +444,12 @@ void plat_draw_splash_screen() {
     plat_draw_text((SCREEN_TEXT_WIDTH - title2_len) / 2, SCREEN_TEXT_HEIGHT / 2 , global.text.title_line2, title2_len);
     plat_draw_text((SCREEN_TEXT_WIDTH - title3_len) / 2, SCREEN_TEXT_HEIGHT / 2 + 1, global.text.title_line3, title3_len);
 
-    hires_draw(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_DISPLAY_HEIGHT / 2 - 50 - SQUARE_DISPLAY_HEIGHT / 2,
-               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT, ROP_CPY,
-               hires_pieces[KING - 1][SIDE_BLACK]);
-    hires_draw(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_DISPLAY_HEIGHT / 2 + 50 - SQUARE_DISPLAY_HEIGHT / 2,
-               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT, ROP_CPY,
-               hires_pieces[KING - 1][SIDE_WHITE]);
+    hires_copy(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_DISPLAY_HEIGHT / 2 - 50 - SQUARE_DISPLAY_HEIGHT / 2,
+               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT,
+               hires_tiles[TILE_PIECE(KING, SIDE_BLACK)][0]);
+    hires_copy(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_DISPLAY_HEIGHT / 2 + 50 - SQUARE_DISPLAY_HEIGHT / 2,
+               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT,
+               hires_tiles[TILE_PIECE(KING, SIDE_WHITE)][0]);
 
     plat_core_key_wait_any();
 
@@ -285,25 +460,17 @@ void plat_draw_splash_screen() {
 /*-----------------------------------------------------------------------*/
 // Draw a tile with background and piece on it for positions 0..63
 void plat_draw_square(uint8_t position) {
-    unsigned rop;
-    uint8_t inv;
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-    uint8_t piece = fics_letter_to_piece(global.state.chess_board[position]);
-    bool black_or_white = !((x & 1) ^ (y & 1));
-
-    if (piece) {
-        rop = black_or_white ? ROP_INV : ROP_CPY;
-        inv = black_or_white ^ !((piece & PIECE_WHITE) == 0);
-    } else {
-        rop = black_or_white ? ROP_WHITE : ROP_BLACK;
-        inv = 0;
-        piece = 1;
-    }
+    uint8_t tile;
+    uint8_t square = position ^ global.view.flip;
+    uint8_t piece = global.state.chess_board[position];
+
+    global.state.drawn_board[position] = piece;
 
-    hires_draw(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT,
-               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT, rop,
-               hires_pieces[(piece & 127) - 1][inv]);
+    tile = piece ? TILE_PIECE(piece & ~PIECE_WHITE, (piece & PIECE_WHITE) ? SIDE_WHITE : SIDE_BLACK) : TILE_EMPTY;
+    hires_copy(square_x[square], square_y[square],
+               SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT,
+               hires_tiles[tile][square_light[square]]);
+    plat_draw_save_under_patch(square_x[square], square_y[square], SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -313,13 +480,10 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
         while (len--) {
             cputc(*text++);
         }
+    } else if (y == TEXT_ROW) {
+        plat_draw_text_row(x, text, len);
     } else {
-        y *= CHARACTER_HEIGHT;
-        while (len) {
-            plat_draw_char(x++, y, ROP_CPY, *text);
-            len--;
-            text++;
-        }
+        hires_text(x, y * CHARACTER_HEIGHT, text, len, ROP_CPY);
     }
 }
 
@@ -357,6 +521,11 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 }
 
 /*-----------------------------------------------------------------------*/
+// The main loop comes back around to app_draw_update, so if that has
+// drawing to do, let it start at the top of a frame
 void plat_draw_update() {
+    if (app_draw_pending()) {
+        waitvsync();
+    }
 }
 
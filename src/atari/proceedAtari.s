@@ -0,0 +1,29 @@
+;
+; proceedAtari.s
+; RetroMate
+;
+; By S. Wessels and O. Schmidt, 2025.
+; This is free and unencumbered software released into the public domain.
+;
+; The FujiNet pulls the SIO PROCEED line when the network device has data
+; waiting (or the connection changed).  net_proceed is hooked into VPRCED
+; and only notes that, so plat_net_update knows when to ask for status.
+;
+
+.export _net_proceed, _net_data_ready
+
+;-----------------------------------------------------------------------
+.segment "BSS"
+_net_data_ready:
+.res 1
+
+;-----------------------------------------------------------------------
+.code
+
+; The OS pushed A before jumping through VPRCED
+.proc _net_proceed
+        lda #1
+        sta _net_data_ready
+        pla
+        rti
+.endproc
@@ -0,0 +1,100 @@
+/*
+ *  charsC64.c
+ *  RetroMate
+ *
+ *  By S. Wessels and O. Schmidt, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  The hires_* calls for C64_CHAR_BOARD, where the board is shown in
+ *  character mode.  Instead of 8 bytes of bitmap per cell these write one
+ *  character code to SCREEN_RAM and one color to COLOR_RAM.  hiresC64.s
+ *  has the bitmap versions.
+ */
+
+#ifdef C64_CHAR_BOARD
+
+#include <c64.h>
+
+#include "../global.h"
+
+#include "platC64.h"
+
+/*-----------------------------------------------------------------------*/
+// The screen code for a character of text.  Only the ROM's upper case set
+// is in the charset, so both cases of letters show as upper case
+static char chars_screen_code(char c) {
+    if (c & 0x80) {
+        // PETSCII upper case, from plat_core_copy_ascii_to_display, else
+        // something like the cursor which shows as a block
+        return (c >= 0xC1 && c <= 0xDA) ? c & 0x1F : CHARS_SOLID;
+    }
+    if (c < 0x20) {
+        return ' ';
+    }
+    if (c >= 0x40) {
+        c &= 0x1F;
+        // These codes hold tile glyphs
+        if (c == 28 || c == 30 || c == 31) {
+            return ' ';
+        }
+    }
+    return c;
+}
+
+/*-----------------------------------------------------------------------*/
+// Fill with spaces for ROP_BLACK, or with solid cells for ROP_WHITE
+void hires_mask(char xpos, char ypos, char xsize, char ysize, unsigned rop) {
+    char *screen = SCREEN_RAM + ypos * SCREEN_TEXT_WIDTH + xpos;
+    char c = (char)rop ? CHARS_SOLID : ' ';
+    char x;
+
+    while (ysize--) {
+        for (x = 0; x < xsize; x++) {
+            screen[x] = c;
+        }
+        screen += SCREEN_TEXT_WIDTH;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// src holds xsize * ysize character codes, such as a tile from char_tiles
+void hires_copy(char xpos, char ypos, char xsize, char ysize, char *src) {
+    char *screen = SCREEN_RAM + ypos * SCREEN_TEXT_WIDTH + xpos;
+    char x;
+
+    while (ysize--) {
+        for (x = 0; x < xsize; x++) {
+            screen[x] = *src++;
+        }
+        screen += SCREEN_TEXT_WIDTH;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// color is as for the bitmap, set bits in the high and clear bits in the
+// low nibble.  Clear bits show the black screen background here, so the
+// cell takes the high nibble, or the low nibble when that is black
+void hires_color(char xpos, char ypos, char xsize, char ysize, char color) {
+    char *colors = (char *)COLOR_RAM + ypos * SCREEN_TEXT_WIDTH + xpos;
+    char x;
+
+    color = (color >> 4) == COLOR_BLACK ? color & 0x0F : color >> 4;
+    while (ysize--) {
+        for (x = 0; x < xsize; x++) {
+            colors[x] = color;
+        }
+        colors += SCREEN_TEXT_WIDTH;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void hires_text(char xpos, char ypos, const char *text, char len, unsigned rop) {
+    char *screen = SCREEN_RAM + ypos * SCREEN_TEXT_WIDTH + xpos;
+
+    UNUSED(rop);
+    while (len--) {
+        *screen++ = chars_screen_code(*text++);
+    }
+}
+
+#endif // C64_CHAR_BOARD
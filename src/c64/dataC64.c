@@ -11,9 +11,288 @@
 #include "platC64.h"
 
 /*-----------------------------------------------------------------------*/
-// C64 specific graphics for the chess pieces
+// C64 specific graphics for the chess squares, made by genpieces.cpp
+#ifdef C64_CHAR_BOARD
+// The glyphs for character codes 28, 30, 31 and 64..255, then each tile
+// as 3 lines of 3 character codes
+char char_glyphs[3 + 192][CHARACTER_HEIGHT] = {
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 28
+    {0x00, 0x00, 0x1E, 0x12, 0x12, 0x13, 0x10, 0x08}, // 30
+    {0x00, 0x00, 0x3E, 0x22, 0x22, 0xE3, 0x00, 0x00}, // 31
+    {0x00, 0x00, 0x3C, 0x24, 0x24, 0xE4, 0x04, 0x08}, // 64
+    {0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01}, // 65
+    {0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // 66
+    {0x10, 0xA0, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40}, // 67
+    {0x02, 0x04, 0x05, 0x08, 0x1F, 0x1F, 0x00, 0x00}, // 68
+    {0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00}, // 69
+    {0x20, 0x10, 0xD0, 0x08, 0xFC, 0xFC, 0x00, 0x00}, // 70
+    {0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xF0}, // 71
+    {0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x00, 0x00, 0x00}, // 72
+    {0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x07}, // 73
+    {0xF8, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE}, // 74
+    {0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00}, // 75
+    {0x0F, 0x1F, 0xDF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F}, // 76
+    {0xFC, 0xF8, 0xF8, 0xF7, 0xE0, 0xE0, 0xFF, 0xFF}, // 77
+    {0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF}, // 78
+    {0x1F, 0x0F, 0x0F, 0xF7, 0x03, 0x03, 0xFF, 0xFF}, // 79
+    {0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x0F}, // 80
+    {0x00, 0x00, 0x3E, 0x3E, 0x3E, 0xFF, 0xFF, 0xFF}, // 81
+    {0x00, 0x00, 0x3C, 0x3C, 0x3C, 0xFC, 0xFC, 0xF8}, // 82
+    {0x07, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01}, // 83
+    {0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 84
+    {0xF0, 0xE0, 0x20, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0}, // 85
+    {0x03, 0x07, 0x07, 0x08, 0x1F, 0x1F, 0x00, 0x00}, // 86
+    {0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00}, // 87
+    {0xE0, 0xF0, 0xF0, 0x08, 0xFC, 0xFC, 0x00, 0x00}, // 88
+    {0xFF, 0xFF, 0xE1, 0xED, 0xED, 0xEC, 0xEF, 0xF7}, // 89
+    {0xFF, 0xFF, 0xC1, 0xDD, 0xDD, 0x1C, 0xFF, 0xFF}, // 90
+    {0xFF, 0xFF, 0xC3, 0xDB, 0xDB, 0x1B, 0xFB, 0xF7}, // 91
+    {0xFB, 0xFD, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE}, // 92
+    {0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, // 93
+    {0xEF, 0x5F, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF}, // 94
+    {0xFD, 0xFB, 0xFA, 0xF7, 0xE0, 0xE0, 0xFF, 0xFF}, // 95
+    {0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF}, // 96
+    {0xDF, 0xEF, 0x2F, 0xF7, 0x03, 0x03, 0xFF, 0xFF}, // 97
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02}, // 98
+    {0x00, 0x00, 0x44, 0xAA, 0x09, 0x00, 0x00, 0x21}, // 99
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40}, // 100
+    {0x02, 0x04, 0x08, 0x10, 0x10, 0x09, 0x06, 0x00}, // 101
+    {0x01, 0x01, 0x00, 0x00, 0xF0, 0x08, 0x10, 0x20}, // 102
+    {0x40, 0xA0, 0xA0, 0x20, 0x20, 0xB0, 0xD0, 0x48}, // 103
+    {0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00}, // 104
+    {0x40, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00}, // 105
+    {0x28, 0x0C, 0x04, 0xF4, 0x04, 0xFC, 0x00, 0x00}, // 106
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC}, // 107
+    {0xFF, 0xFF, 0xBB, 0x55, 0x08, 0x00, 0x00, 0x21}, // 108
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F}, // 109
+    {0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0xF0, 0xF9, 0xFF}, // 110
+    {0x01, 0x01, 0x00, 0x00, 0x00, 0xF0, 0xE0, 0xC0}, // 111
+    {0x3F, 0x9F, 0x9F, 0x1F, 0x1F, 0x8F, 0xCF, 0x47}, // 112
+    {0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF}, // 113
+    {0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF}, // 114
+    {0x27, 0x03, 0x03, 0xFB, 0x03, 0x03, 0xFF, 0xFF}, // 115
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03}, // 116
+    {0x00, 0x00, 0x44, 0xAA, 0xF7, 0xFF, 0xFF, 0xDE}, // 117
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0}, // 118
+    {0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x0F, 0x06, 0x00}, // 119
+    {0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0x3F}, // 120
+    {0xC0, 0x60, 0x60, 0xE0, 0xE0, 0x70, 0x30, 0xB8}, // 121
+    {0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00}, // 122
+    {0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00}, // 123
+    {0xD8, 0xFC, 0xFC, 0x04, 0xFC, 0xFC, 0x00, 0x00}, // 124
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD}, // 125
+    {0xFF, 0xFF, 0xBB, 0x55, 0xF6, 0xFF, 0xFF, 0xDE}, // 126
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF}, // 127
+    {0xFD, 0xFB, 0xF7, 0xEF, 0xEF, 0xF6, 0xF9, 0xFF}, // 128
+    {0xFE, 0xFE, 0xFF, 0xFF, 0x0F, 0xF7, 0xEF, 0xDF}, // 129
+    {0xBF, 0x5F, 0x5F, 0xDF, 0xDF, 0x4F, 0x2F, 0xB7}, // 130
+    {0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFF, 0xFF}, // 131
+    {0xBF, 0x7F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF}, // 132
+    {0xD7, 0xF3, 0xFB, 0x0B, 0xFB, 0x03, 0xFF, 0xFF}, // 133
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}, // 134
+    {0x00, 0x00, 0x00, 0x1C, 0x22, 0x41, 0x88, 0x08}, // 135
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40}, // 136
+    {0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00}, // 137
+    {0x7F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x80, 0x7F}, // 138
+    {0x40, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00}, // 139
+    {0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x00, 0x00}, // 140
+    {0x41, 0x41, 0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x00}, // 141
+    {0x00, 0x00, 0x00, 0x40, 0xF0, 0xF8, 0x00, 0x00}, // 142
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE}, // 143
+    {0xFF, 0xFF, 0xFF, 0xE3, 0xC1, 0x80, 0x08, 0x08}, // 144
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F}, // 145
+    {0xFE, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF}, // 146
+    {0x7F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0xBE}, // 147
+    {0x3F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0xFF}, // 148
+    {0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xF0, 0xFF, 0xFF}, // 149
+    {0x80, 0x80, 0xC1, 0x00, 0xFF, 0x00, 0xFF, 0xFF}, // 150
+    {0xFF, 0xFF, 0xFF, 0x3F, 0xEF, 0x07, 0xFF, 0xFF}, // 151
+    {0x00, 0x00, 0x00, 0x1C, 0x3E, 0x7F, 0xF7, 0xF7}, // 152
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0}, // 153
+    {0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00}, // 154
+    {0x80, 0xF7, 0xF7, 0xF7, 0xF7, 0xFF, 0xFF, 0x41}, // 155
+    {0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00}, // 156
+    {0x00, 0x00, 0x00, 0x01, 0x04, 0x0F, 0x00, 0x00}, // 157
+    {0x7F, 0x7F, 0x3E, 0xFF, 0x00, 0xFF, 0x00, 0x00}, // 158
+    {0x00, 0x00, 0x00, 0xC0, 0x10, 0xF8, 0x00, 0x00}, // 159
+    {0xFF, 0xFF, 0xFF, 0xE3, 0xDD, 0xBE, 0x77, 0xF7}, // 160
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF}, // 161
+    {0xFE, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF}, // 162
+    {0x80, 0xF7, 0xF7, 0xF7, 0xF7, 0xFF, 0x7F, 0x80}, // 163
+    {0xBF, 0xDF, 0xDF, 0xDF, 0xBF, 0xBF, 0x7F, 0xFF}, // 164
+    {0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xFF, 0xFF}, // 165
+    {0xBE, 0xBE, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0xFF}, // 166
+    {0xFF, 0xFF, 0xFF, 0xBF, 0x0F, 0x07, 0xFF, 0xFF}, // 167
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10}, // 168
+    {0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x94, 0xA2}, // 169
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x84}, // 170
+    {0x11, 0x10, 0x11, 0x11, 0x08, 0x08, 0x04, 0x04}, // 171
+    {0x41, 0x00, 0x08, 0x9C, 0xFF, 0x7F, 0x00, 0x00}, // 172
+    {0x44, 0x04, 0x44, 0xC4, 0x88, 0x08, 0x10, 0x10}, // 173
+    {0x05, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00}, // 174
+    {0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00}, // 175
+    {0xD0, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00}, // 176
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0}, // 177
+    {0xFF, 0xFF, 0xFF, 0xE3, 0xC1, 0xC1, 0x63, 0x41}, // 178
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x03}, // 179
+    {0xE0, 0xE0, 0xE1, 0xE1, 0xF0, 0xF0, 0xF8, 0xF8}, // 180
+    {0x80, 0x00, 0x08, 0x9C, 0xFF, 0x7F, 0x00, 0x00}, // 181
+    {0x83, 0x03, 0x43, 0xC3, 0x87, 0x07, 0x0F, 0x0F}, // 182
+    {0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF}, // 183
+    {0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}, // 184
+    {0xCF, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF}, // 185
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F}, // 186
+    {0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x9C, 0xBE}, // 187
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xFC}, // 188
+    {0x1F, 0x1F, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07}, // 189
+    {0x7F, 0xFF, 0xF7, 0x63, 0x00, 0x80, 0xFF, 0xFF}, // 190
+    {0x7C, 0xFC, 0xBC, 0x3C, 0x78, 0xF8, 0xF0, 0xF0}, // 191
+    {0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00}, // 192
+    {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00}, // 193
+    {0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00}, // 194
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF7, 0xEF}, // 195
+    {0xFF, 0xFF, 0xFF, 0xE3, 0xDD, 0xDD, 0x6B, 0x5D}, // 196
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x77, 0x7B}, // 197
+    {0xEE, 0xEF, 0xEE, 0xEE, 0xF7, 0xF7, 0xFB, 0xFB}, // 198
+    {0xBE, 0xFF, 0xF7, 0x63, 0x00, 0x80, 0xFF, 0xFF}, // 199
+    {0xBB, 0xFB, 0xBB, 0x3B, 0x77, 0xF7, 0xEF, 0xEF}, // 200
+    {0xFA, 0xFD, 0xFD, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF}, // 201
+    {0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF}, // 202
+    {0x2F, 0xDF, 0xDF, 0xDF, 0x9F, 0x3F, 0xFF, 0xFF}, // 203
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02}, // 204
+    {0x00, 0x00, 0x1C, 0x14, 0x77, 0x63, 0x94, 0x55}, // 205
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20}, // 206
+    {0x04, 0x08, 0x09, 0x12, 0x12, 0x11, 0x08, 0x08}, // 207
+    {0x36, 0x14, 0x22, 0x14, 0x08, 0x08, 0x80, 0x41}, // 208
+    {0x10, 0x08, 0x48, 0x24, 0x24, 0x44, 0x88, 0x08}, // 209
+    {0x04, 0x04, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00}, // 210
+    {0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00}, // 211
+    {0x10, 0x90, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00}, // 212
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC}, // 213
+    {0xFF, 0xFF, 0xE3, 0xEB, 0x88, 0x9C, 0x6B, 0x2A}, // 214
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F}, // 215
+    {0xF8, 0xF0, 0xF1, 0xE2, 0xE2, 0xE1, 0xF0, 0xF0}, // 216
+    {0x08, 0x1C, 0x2A, 0x1C, 0x08, 0x00, 0x80, 0x41}, // 217
+    {0x0F, 0x07, 0x47, 0x23, 0x23, 0x43, 0x87, 0x07}, // 218
+    {0xF8, 0xF9, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF}, // 219
+    {0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF}, // 220
+    {0x0F, 0xCF, 0x1F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF}, // 221
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03}, // 222
+    {0x00, 0x00, 0x1C, 0x14, 0x77, 0x63, 0x94, 0xD5}, // 223
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0}, // 224
+    {0x07, 0x0F, 0x0E, 0x1D, 0x1D, 0x1E, 0x0F, 0x0F}, // 225
+    {0xF7, 0xE3, 0xD5, 0xE3, 0xF7, 0xFF, 0x7F, 0xBE}, // 226
+    {0xF0, 0xF8, 0xB8, 0xDC, 0xDC, 0xBC, 0x78, 0xF8}, // 227
+    {0x07, 0x06, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00}, // 228
+    {0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00}, // 229
+    {0xF0, 0x30, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00}, // 230
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD}, // 231
+    {0xFF, 0xFF, 0xE3, 0xEB, 0x88, 0x9C, 0x6B, 0xAA}, // 232
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xDF}, // 233
+    {0xFB, 0xF7, 0xF6, 0xED, 0xED, 0xEE, 0xF7, 0xF7}, // 234
+    {0xC9, 0xEB, 0xDD, 0xEB, 0xF7, 0xF7, 0x7F, 0xBE}, // 235
+    {0xEF, 0xF7, 0xB7, 0xDB, 0xDB, 0xBB, 0x77, 0xF7}, // 236
+    {0xFB, 0xFB, 0xFD, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF}, // 237
+    {0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF}, // 238
+    {0xEF, 0x6F, 0xDF, 0xDF, 0x9F, 0x3F, 0xFF, 0xFF}, // 239
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x22}, // 240
+    {0x41, 0x41, 0x41, 0x22, 0x1C, 0x22, 0x22, 0x63}, // 241
+    {0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00}, // 242
+    {0x22, 0x22, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00}, // 243
+    {0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00}, // 244
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xC1}, // 245
+    {0x80, 0x80, 0x80, 0xC1, 0xE3, 0xC1, 0xC1, 0x80}, // 246
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF}, // 247
+    {0xC1, 0xC1, 0x80, 0x7F, 0x00, 0x00, 0xFF, 0xFF}, // 248
+    {0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF}, // 249
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E}, // 250
+    {0x7F, 0x7F, 0x7F, 0x3E, 0x1C, 0x3E, 0x3E, 0x7F}, // 251
+    {0x3E, 0x3E, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00}, // 252
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xDD}, // 253
+    {0xBE, 0xBE, 0xBE, 0xDD, 0xE3, 0xDD, 0xDD, 0x9C}, // 254
+    {0xDD, 0xDD, 0x80, 0x7F, 0x00, 0x00, 0xFF, 0xFF}, // 255
+};
+char char_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_TEXT_HEIGHT] = {
+    {
+        { 32,  32,  32,  32,  32,  32,  32,  32,  32},
+        { 28,  28,  28,  28,  28,  28,  28,  28,  28},
+    },
+    {
+        { 30,  31,  64,  65,  66,  67,  68,  69,  70},
+        { 71,  72,  73,  74,  75,  76,  77,  78,  79},
+    },
+    {
+        { 80,  81,  82,  83,  84,  85,  86,  87,  88},
+        { 89,  90,  91,  92,  93,  94,  95,  96,  97},
+    },
+    {
+        { 98,  99, 100, 101, 102, 103, 104, 105, 106},
+        {107, 108, 109, 110, 111, 112, 113, 114, 115},
+    },
+    {
+        {116, 117, 118, 119, 120, 121, 122, 123, 124},
+        {125, 126, 127, 128, 129, 130, 131, 132, 133},
+    },
+    {
+        {134, 135, 136, 137, 138, 139, 140, 141, 142},
+        {143, 144, 145, 146, 147, 148, 149, 150, 151},
+    },
+    {
+        {134, 152, 153, 154, 155, 156, 157, 158, 159},
+        {143, 160, 161, 162, 163, 164, 165, 166, 167},
+    },
+    {
+        {168, 169, 170, 171, 172, 173, 174, 175, 176},
+        {177, 178, 179, 180, 181, 182, 183, 184, 185},
+    },
+    {
+        {186, 187, 188, 189, 190, 191, 192, 193, 194},
+        {195, 196, 197, 198, 199, 200, 201, 202, 203},
+    },
+    {
+        {204, 205, 206, 207, 208, 209, 210, 211, 212},
+        {213, 214, 215, 216, 217, 218, 219, 220, 221},
+    },
+    {
+        {222, 223, 224, 225, 226, 227, 228, 229, 230},
+        {231, 232, 233, 234, 235, 236, 237, 238, 239},
+    },
+    {
+        { 32, 240,  32,  32, 241,  32, 242, 243, 244},
+        { 28, 245,  28,  28, 246,  28, 247, 248, 249},
+    },
+    {
+        { 32, 250,  32,  32, 251,  32, 242, 252, 244},
+        { 28, 253,  28,  28, 254,  28, 247, 255, 249},
+    },
+};
+#else
 // 72 = 8 rows (character heigt) * 3 colomns (width) * 3 (character lines [of 8 rows and 3 columns each])
-char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
+char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
+    {
+        {
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        },
+    },
     {
         {
             0x00, 0x00, 0x1E, 0x12, 0x12, 0x13, 0x10, 0x08,
@@ -26,6 +305,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
             0x20, 0x10, 0xD0, 0x08, 0xFC, 0xFC, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xE1, 0xE1, 0xE1, 0xE0, 0xE0, 0xF0,
+            0xFF, 0xFF, 0xC1, 0xC1, 0xC1, 0x00, 0x00, 0x00,
+            0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0x03, 0x03, 0x07,
+            0xF8, 0xFC, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+            0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0F, 0x1F, 0xDF, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+            0xFC, 0xF8, 0xF8, 0xF7, 0xE0, 0xE0, 0xFF, 0xFF,
+            0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+            0x1F, 0x0F, 0x0F, 0xF7, 0x03, 0x03, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x0F,
             0x00, 0x00, 0x3E, 0x3E, 0x3E, 0xFF, 0xFF, 0xFF,
@@ -37,6 +329,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
             0xE0, 0xF0, 0xF0, 0x08, 0xFC, 0xFC, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xE1, 0xED, 0xED, 0xEC, 0xEF, 0xF7,
+            0xFF, 0xFF, 0xC1, 0xDD, 0xDD, 0x1C, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xC3, 0xDB, 0xDB, 0x1B, 0xFB, 0xF7,
+            0xFB, 0xFD, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE,
+            0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xEF, 0x5F, 0x9F, 0xBF, 0xBF, 0xBF, 0xBF, 0xBF,
+            0xFD, 0xFB, 0xFA, 0xF7, 0xE0, 0xE0, 0xFF, 0xFF,
+            0xFF, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+            0xDF, 0xEF, 0x2F, 0xF7, 0x03, 0x03, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -50,6 +353,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x40, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
             0x28, 0x0C, 0x04, 0xF4, 0x04, 0xFC, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xFC,
+            0xFF, 0xFF, 0xBB, 0x55, 0x08, 0x00, 0x00, 0x21,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F,
+            0xFC, 0xF8, 0xF0, 0xE0, 0xE0, 0xF0, 0xF9, 0xFF,
+            0x01, 0x01, 0x00, 0x00, 0x00, 0xF0, 0xE0, 0xC0,
+            0x3F, 0x9F, 0x9F, 0x1F, 0x1F, 0x8F, 0xCF, 0x47,
+            0xFF, 0xFF, 0xFE, 0xFD, 0xFC, 0xFC, 0xFF, 0xFF,
+            0x80, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+            0x27, 0x03, 0x03, 0xFB, 0x03, 0x03, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03,
             0x00, 0x00, 0x44, 0xAA, 0xF7, 0xFF, 0xFF, 0xDE,
@@ -61,6 +377,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
             0xD8, 0xFC, 0xFC, 0x04, 0xFC, 0xFC, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFD, 0xFD,
+            0xFF, 0xFF, 0xBB, 0x55, 0xF6, 0xFF, 0xFF, 0xDE,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF, 0xBF,
+            0xFD, 0xFB, 0xF7, 0xEF, 0xEF, 0xF6, 0xF9, 0xFF,
+            0xFE, 0xFE, 0xFF, 0xFF, 0x0F, 0xF7, 0xEF, 0xDF,
+            0xBF, 0x5F, 0x5F, 0xDF, 0xDF, 0x4F, 0x2F, 0xB7,
+            0xFF, 0xFF, 0xFE, 0xFD, 0xFD, 0xFC, 0xFF, 0xFF,
+            0xBF, 0x7F, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+            0xD7, 0xF3, 0xFB, 0x0B, 0xFB, 0x03, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -74,6 +401,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x41, 0x41, 0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x40, 0xF0, 0xF8, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+            0xFF, 0xFF, 0xFF, 0xE3, 0xC1, 0x80, 0x08, 0x08,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F,
+            0xFE, 0xFC, 0xFC, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF,
+            0x7F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0xBE,
+            0x3F, 0x1F, 0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFE, 0xFB, 0xF0, 0xFF, 0xFF,
+            0x80, 0x80, 0xC1, 0x00, 0xFF, 0x00, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0x3F, 0xEF, 0x07, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
             0x00, 0x00, 0x00, 0x1C, 0x3E, 0x7F, 0xF7, 0xF7,
@@ -85,6 +425,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x7F, 0x7F, 0x3E, 0xFF, 0x00, 0xFF, 0x00, 0x00,
             0x00, 0x00, 0x00, 0xC0, 0x10, 0xF8, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
+            0xFF, 0xFF, 0xFF, 0xE3, 0xDD, 0xBE, 0x77, 0xF7,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xBF,
+            0xFE, 0xFD, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF,
+            0x80, 0xF7, 0xF7, 0xF7, 0xF7, 0xFF, 0x7F, 0x80,
+            0xBF, 0xDF, 0xDF, 0xDF, 0xBF, 0xBF, 0x7F, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFE, 0xF8, 0xF0, 0xFF, 0xFF,
+            0xBE, 0xBE, 0xC1, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xBF, 0x0F, 0x07, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -98,6 +449,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
             0xD0, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF0, 0xE0,
+            0xFF, 0xFF, 0xFF, 0xE3, 0xC1, 0xC1, 0x63, 0x41,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x07, 0x03,
+            0xE0, 0xE0, 0xE1, 0xE1, 0xF0, 0xF0, 0xF8, 0xF8,
+            0x80, 0x00, 0x08, 0x9C, 0xFF, 0x7F, 0x00, 0x00,
+            0x83, 0x03, 0x43, 0xC3, 0x87, 0x07, 0x0F, 0x0F,
+            0xF9, 0xFC, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF,
+            0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+            0xCF, 0x1F, 0x1F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F,
             0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x9C, 0xBE,
@@ -109,6 +473,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
             0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0xF7, 0xEF,
+            0xFF, 0xFF, 0xFF, 0xE3, 0xDD, 0xDD, 0x6B, 0x5D,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x77, 0x7B,
+            0xEE, 0xEF, 0xEE, 0xEE, 0xF7, 0xF7, 0xFB, 0xFB,
+            0xBE, 0xFF, 0xF7, 0x63, 0x00, 0x80, 0xFF, 0xFF,
+            0xBB, 0xFB, 0xBB, 0x3B, 0x77, 0xF7, 0xEF, 0xEF,
+            0xFA, 0xFD, 0xFD, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF,
+            0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+            0x2F, 0xDF, 0xDF, 0xDF, 0x9F, 0x3F, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -122,6 +497,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
             0x10, 0x90, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC,
+            0xFF, 0xFF, 0xE3, 0xEB, 0x88, 0x9C, 0x6B, 0x2A,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x1F,
+            0xF8, 0xF0, 0xF1, 0xE2, 0xE2, 0xE1, 0xF0, 0xF0,
+            0x08, 0x1C, 0x2A, 0x1C, 0x08, 0x00, 0x80, 0x41,
+            0x0F, 0x07, 0x47, 0x23, 0x23, 0x43, 0x87, 0x07,
+            0xF8, 0xF9, 0xFC, 0xFC, 0xFC, 0xFE, 0xFF, 0xFF,
+            0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
+            0x0F, 0xCF, 0x1F, 0x1F, 0x1F, 0x3F, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
             0x00, 0x00, 0x1C, 0x14, 0x77, 0x63, 0x94, 0xD5,
@@ -133,6 +521,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
             0xF0, 0x30, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFD,
+            0xFF, 0xFF, 0xE3, 0xEB, 0x88, 0x9C, 0x6B, 0xAA,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xDF,
+            0xFB, 0xF7, 0xF6, 0xED, 0xED, 0xEE, 0xF7, 0xF7,
+            0xC9, 0xEB, 0xDD, 0xEB, 0xF7, 0xF7, 0x7F, 0xBE,
+            0xEF, 0xF7, 0xB7, 0xDB, 0xDB, 0xBB, 0x77, 0xF7,
+            0xFB, 0xFB, 0xFD, 0xFD, 0xFC, 0xFE, 0xFF, 0xFF,
+            0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF,
+            0xEF, 0x6F, 0xDF, 0xDF, 0x9F, 0x3F, 0xFF, 0xFF,
+        },
     },
     {
         {
@@ -146,6 +545,19 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x22, 0x22, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xC1,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0x80, 0x80, 0x80, 0xC1, 0xE3, 0xC1, 0xC1, 0x80,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF,
+            0xC1, 0xC1, 0x80, 0x7F, 0x00, 0x00, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF,
+        },
+    },
+    {
         {
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E,
@@ -157,5 +569,17 @@ char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
             0x3E, 0x3E, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00,
             0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00,
         },
+        {
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0xDD,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xBE, 0xBE, 0xBE, 0xDD, 0xE3, 0xDD, 0xDD, 0x9C,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFF, 0xFF,
+            0xDD, 0xDD, 0x80, 0x7F, 0x00, 0x00, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x3F, 0xFF, 0xFF,
+        },
     },
 };
+#endif
@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <memory.h>
 #include <string.h>
+#include <stdlib.h>
 
 char pieces[]=
 "                        "
@@ -310,15 +311,126 @@ char pieces[]=
 "                        "
 ;
 
+// 3x3 characters of 8 bytes each per piece, in 2 versions
+#define TILE_SIZE   (3 * 3 * 8)
+
+unsigned char images[6][2][TILE_SIZE];
+unsigned char blank[TILE_SIZE];
+
+// Print a piece as it shows on a dark or a light square.  On a light
+// square it's inverted, so the tile can be copied to the screen as is
+void tile(const unsigned char *image, int light)
+{
+    printf("        {\n");
+    for(int i = 0; i < TILE_SIZE; ++i) {
+        if(!(i % 8)) {
+            printf("           ");
+        }
+        printf(" 0x%02X,", (unsigned char)(light ? ~image[i] : image[i]));
+        if(i % 8 == 7) {
+            printf("\n");
+        }
+    }
+    printf("        },\n");
+}
+
+// The character codes the tile glyphs go in: 28, 30 and 31 (the pound
+// sign and arrows, which ASCII text doesn't use) and then 64..255.  The
+// text keeps the ROM's upper case set in the rest of 0..63
+#define CHAR_GLYPHS     (3 + 192)
+#define CHAR_SPACE      32
+
+unsigned char glyphs[CHAR_GLYPHS][8];
+int num_glyphs;
+unsigned char codes[1 + 6 * 2][2][3 * 3];
+
+int glyph_code(int glyph)
+{
+    return glyph < 3 ? 28 + glyph + (glyph > 0) : 64 + glyph - 3;
+}
+
+// Look up (or add) the code for one 8x8 cell of a tile
+int cell_code(const unsigned char *image, int light)
+{
+    unsigned char cell[8];
+    int glyph;
+
+    for(int row = 0; row < 8; ++row) {
+        cell[row] = light ? ~image[row] : image[row];
+    }
+    if(!memcmp(cell, blank, 8)) {
+        return CHAR_SPACE;
+    }
+    for(glyph = 0; glyph < num_glyphs; ++glyph) {
+        if(!memcmp(cell, glyphs[glyph], 8)) {
+            return glyph_code(glyph);
+        }
+    }
+    if(num_glyphs == CHAR_GLYPHS) {
+        fprintf(stderr, "More than %d distinct cells\n", CHAR_GLYPHS);
+        exit(1);
+    }
+    memcpy(glyphs[num_glyphs], cell, 8);
+    return glyph_code(num_glyphs++);
+}
+
+void tile_codes(unsigned char *dest, const unsigned char *image, int light)
+{
+    for(int cell = 0; cell < 3 * 3; ++cell) {
+        dest[cell] = cell_code(image + cell * 8, light);
+    }
+}
+
+// Print the glyphs and the tiles as character codes, in the same order as
+// hires_tiles.  The solid cell is always the first glyph, so CHARS_SOLID
+// (28) can be used to fill areas in
+void charset(void)
+{
+    memset(glyphs[0], 0xFF, 8);
+    num_glyphs = 1;
+    tile_codes(codes[0][0], blank, 0);
+    tile_codes(codes[0][1], blank, 1);
+    for(int piece = 0; piece < 6; ++piece) {
+        for(int side = 0; side < 2; ++side) {
+            tile_codes(codes[1 + piece * 2 + side][0], images[piece][side], 0);
+            tile_codes(codes[1 + piece * 2 + side][1], images[piece][!side], 1);
+        }
+    }
+
+    printf("char char_glyphs[3 + 192][CHARACTER_HEIGHT] = {\n");
+    for(int glyph = 0; glyph < CHAR_GLYPHS; ++glyph) {
+        printf("    {");
+        for(int row = 0; row < 8; ++row) {
+            printf("0x%02X%s", glyphs[glyph][row], row < 7 ? ", " : "");
+        }
+        printf("}, // %d\n", glyph_code(glyph));
+    }
+    printf("};\n");
+
+    printf("char char_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_TEXT_HEIGHT] = {\n");
+    for(int t = 0; t < 1 + 6 * 2; ++t) {
+        printf("    {\n");
+        for(int light = 0; light < 2; ++light) {
+            printf("        {");
+            for(int cell = 0; cell < 3 * 3; ++cell) {
+                printf("%3d%s", codes[t][light][cell], cell < 8 ? ", " : "");
+            }
+            printf("},\n");
+        }
+        printf("    },\n");
+    }
+    printf("};\n");
+}
+
 int main(void)
 {
     unsigned char b = 0;
     unsigned char c[24][3];
-    int col, row, color;
+    unsigned char *image = &images[0][0][0];
+    int col, row;
 
-    col = row = color = 0;
+    col = row = 0;
     memset(c, 0, sizeof(c));
-    printf("char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = \n{\n");
     for(int i=0; i<sizeof(pieces); ++i) {
         b |= (pieces[i] == '*') << ((7-i) % 8);
         if (i % 8 == 7) {
@@ -326,32 +438,46 @@ int main(void)
             b = 0;
             if(++col == 3) {
                 if(++row == 3*8) {
-                    if(0 == color) {
-                        printf("\t{\n");
-                    }
-                    printf("\t\t{\n");
+                    // Store the piece a character at a time
                     for(int line = 0; line < 3; line++) {
                         for(col = 0; col < 3; col++) {
-                            printf("\t\t\t");
                             for(row = 0; row < 8; row++) {
-                                printf("0x%02X, ", c[line*8+row][col]);
+                                *image++ = c[line*8+row][col];
                             }
-                            printf("\n");
                         }
                     }
-                    printf("\t\t},\n");
                     memset(c, 0, sizeof(c));
-                    if(++color == 2) {
-                        printf("\t},\n");
-                        color = 0;
-                    }
                     row = 0;
                 }
                 col = 0;
             }
         }
     }
-    printf("}");
+
+    // C64_CHAR_BOARD draws the same tiles with characters instead.  Every
+    // distinct 8x8 cell becomes a glyph, and each tile 3x3 character codes
+    printf("#ifdef C64_CHAR_BOARD\n");
+    charset();
+    printf("#else\n");
+
+    // The empty square, then each piece in black and in white.  Every tile
+    // is there for a dark and a light square.  On a light square the other
+    // version of the piece is used, since the tile gets inverted
+    printf("char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {\n");
+    printf("    {\n");
+    tile(blank, 0);
+    tile(blank, 1);
+    printf("    },\n");
+    for(int piece = 0; piece < 6; ++piece) {
+        for(int side = 0; side < 2; ++side) {
+            printf("    {\n");
+            tile(images[piece][side], 0);
+            tile(images[piece][!side], 1);
+            printf("    },\n");
+        }
+    }
+    printf("};\n");
+    printf("#endif\n");
 
     return 0;
 }
@@ -7,7 +7,10 @@
 ;
 ;
 
-.export _hires_draw, _hires_mask, _hires_color
+; charsC64.c has these for the character mode board
+.ifndef C64_CHAR_BOARD
+
+.export _hires_draw, _hires_copy, _hires_mask, _hires_color, _hires_text
 
 .include "c64.inc"
 .include "zeropage.inc"
@@ -131,6 +134,89 @@ ymax:   cpx #$FF    ; Patched
 .endproc
 
 
+.proc   _hires_copy
+
+        sta src+1   ; 'src' lo
+        stx src+2   ; 'src' hi
+
+        jsr popa    ; 'ysize'
+        sta ymax+1
+
+        jsr popa    ; 'xsize'
+        sta xmax+1
+
+        jsr popa    ; 'ypos'
+        sta ypos+1
+
+        clc
+        adc ymax+1
+        sta ymax+1
+
+        jsr popa    ; 'xpos'
+        sta xpos+1
+
+        clc
+        adc xmax+1
+        sta xmax+1
+
+        lda #0
+        sta xoffhi+1
+        lda xpos+1
+        beq :+
+        asl         ; mult 8
+        rol xoffhi+1
+        asl
+        rol xoffhi+1
+        asl
+        rol xoffhi+1
+:       sta xofflo+1
+
+        sei         ; stop interrupts
+        lda #$34    ; Basic ROM off; Kernal ROM off; I/O off
+        sta 1
+
+        ldy #$00
+        ldx ypos+1      ; start row
+yloop:  clc
+xofflo: lda #$FF        ; Patched
+        adc BASELO,x
+        sta dst+1
+xoffhi: lda #$FF        ; Patched
+        adc BASEHI,x
+        sta dst+2
+
+xpos:   lda #$FF        ; Patched
+        sta xcurr+1
+xloop:  ldx #0          ; do one character column
+src:    lda $ffff,y ; Patched
+        iny
+dst:    sta $ffff,x ; Patched
+        inx
+        cpx #8
+        bne src
+
+        clc
+        lda dst+1 ; next col
+        adc #8
+        sta dst+1
+        bcc :+
+        inc dst+2
+:       inc xcurr+1
+xcurr:  ldx #$FF        ; Patched
+xmax:   cpx #$FF    ; Patched
+        bne xloop
+        inc ypos+1
+ypos:   ldx #$FF    ; Patched
+ymax:   cpx #$FF    ; Patched
+        bne yloop
+
+        lda #$36    ; Basic ROM off; Kernal ROM on; I/O on
+        sta 1
+        cli         ; resume interrupts
+        rts
+.endproc
+
+
 .proc   _hires_mask
         stx rop     ; 'rop' hi
         sta rop+1   ; 'rop' lo
@@ -268,3 +354,102 @@ ymax:   cpy #$FF    ; Patched
         cli
         rts
 .endproc
+
+
+; Draws len glyphs from the char map at CHARMAP_RAM, one per cell from xpos on
+.proc   _hires_text
+        stx rop     ; 'rop' hi
+        sta rop+1   ; 'rop' lo
+
+        jsr popa    ; 'len'
+        sta tmp2
+
+        jsr popax   ; 'text'
+        sta text+1
+        stx text+2
+
+        jsr popa    ; 'ypos'
+        tay
+
+        jsr popa    ; 'xpos'
+        ldx #0
+        stx ptr1+1
+        asl         ; mult 8
+        rol ptr1+1
+        asl
+        rol ptr1+1
+        asl
+        rol ptr1+1
+        clc
+        adc BASELO,y
+        sta dst+1
+        lda ptr1+1
+        adc BASEHI,y
+        sta dst+2
+
+        sei         ; stop interrupts
+        lda #$34    ; Basic ROM off; Kernal ROM off; I/O off
+        sta 1
+
+        ldx #0      ; index into text
+cloop:  cpx tmp2
+        beq done
+text:   lda $ffff,x ; Patched
+        inx
+
+        cmp #$C1    ; Same mapping as plat_draw_char
+        bcc lower
+        cmp #$DB
+        bcs map
+        and #$7F    ; Upper case
+        jmp map
+lower:  cmp #$41
+        bcc map
+        cmp #$5B
+        bcs ascii
+        sbc #$3F    ; Lowercase to 1-26 (carry is clear)
+        jmp map
+ascii:  cmp #$61
+        bcc map
+        cmp #$7C
+        bcs map
+        sec
+        sbc #$60    ; Lowercase ascii to 1-26
+
+map:    ldy #0
+        sty ptr1+1
+        asl         ; mult 8
+        rol ptr1+1
+        asl
+        rol ptr1+1
+        asl
+        rol ptr1+1
+        sta src+1
+        lda ptr1+1
+        clc
+        adc #>(CHARMAP_RAM)
+        sta src+2
+
+        ldy #7      ; do one character
+src:    lda $ffff,y ; Patched
+rop:    nop
+        nop
+dst:    sta $ffff,y ; Patched
+        dey
+        bpl src
+
+        clc
+        lda dst+1   ; next cell is 8 away
+        adc #8
+        sta dst+1
+        bcc cloop
+        inc dst+2
+        jmp cloop
+
+done:   lda #$36    ; Basic ROM off; Kernal ROM on; I/O on
+        sta 1
+        cli         ; resume interrupts
+        rts
+.endproc
+
+.endif ; C64_CHAR_BOARD
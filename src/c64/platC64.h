@@ -53,12 +53,18 @@ void plat_core_hires(bool on);
 void hires_draw(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop, char *src);
+void hires_copy(char xpos,    char ypos,
+                char xsize,   char ysize,
+                char *src);
 void hires_mask(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop);
 void hires_color(char xpos,   char ypos,
                  char xsize,  char ysize,
                  char color);
+void hires_text(char xpos,    char ypos,
+                const char *text, char len,
+                unsigned rop);
 
 /*-----------------------------------------------------------------------*/
 typedef struct _c64 {
@@ -74,9 +80,31 @@ typedef struct _c64 {
     char send_buffer[80];
     char terminal_log_buffer[80 * 24];
     char status_log_buffer[13 * 25];
+    uint8_t sprites;                // VIC.spr_ena while the board is showing
 } c64_t;
 
 extern c64_t c64;
-extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+// Sprite 0 is the mouse pointer, 1 and 2 the cursor and selection markers
+#define SPRITE_MOUSE_BLOCK      254
+#define SPRITE_MARKER_BLOCK     253
+extern int8_t SPR_TOP[2];
+extern int8_t SPR_LEFT[2];
+// Pre-composited squares: the empty square, then each piece in black and
+// in white.  Each on a dark [0] and on a light [1] square
+#define TILE_EMPTY              0
+#define TILE_PIECE(type, side)  (((type) << 1) - 1 + (side))
+#ifdef C64_CHAR_BOARD
+// The board is in character mode: the hires_* calls work on character
+// cells, and a tile is 3x3 character codes.  The charset at CHARMAP_RAM is
+// the ROM's upper case set with the tile glyphs in codes 28, 30, 31 and
+// 64..255.  CHARS_SOLID is the glyph with all bits set
+#define CHARS_SOLID             28
+#define BOARD_TILES             char_tiles
+extern char char_glyphs[3 + 192][CHARACTER_HEIGHT];
+extern char char_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_TEXT_HEIGHT];
+#else
+#define BOARD_TILES             hires_tiles
+extern char hires_tiles[1 + 6 * 2][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+#endif
 
 #endif //_PLATC64_H_
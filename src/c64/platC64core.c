@@ -44,6 +44,30 @@ char sprite_data[63] = {
     0x00,0x00,0x00,
     0x00,0x00,0x00,
 };
+// A frame around a square, for the cursor and selection markers
+char marker_sprite_data[63] = {
+    0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xC0,0x00,0x03,
+    0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,
+};
 // PEEK(0x02A6); 0 = NTSC, 1 = PAL
 #define TV_STANDARD (char*)0x02A6
 // NTSC, PAL upper left coords
@@ -62,7 +86,7 @@ void plat_core_active_term(bool active) {
         VIC.bordercolor = COLOR_GREEN;
         plat_core_hires(true);
         global.view.terminal_active = 0;
-        VIC.spr_ena = 1;
+        VIC.spr_ena = c64.sprites;
     }
 }
 
@@ -105,12 +129,21 @@ void plat_core_hires(bool on) {
     if (on) {
         // Select the bank
         CIA2.pra = (CIA2.pra & 0xFC) | (3 - (VIC_BASE_RAM >> 14));
+#ifdef C64_CHAR_BOARD
+        // Set the location of the Screen and the charset
+        VIC.addr = ((((int)(SCREEN_RAM - VIC_BASE_RAM) / 0x0400) << 4) | ((int)(CHARMAP_RAM - VIC_BASE_RAM) / 0x0400));
+
+        // Text mode, not extended color, not multicolor
+        VIC.ctrl1 = VIC.ctrl1 & 0x9F;
+        VIC.ctrl2 = (VIC.ctrl2 & 0xEF);
+#else
         // Set the location of the Screen (color) and bitmap (0 or 8192 only)
         VIC.addr = ((((int)(SCREEN_RAM - VIC_BASE_RAM) / 0x0400) << 4) | (BITMAP_OFFSET / 0X400));
 
         // Turn on HiRes mode
         VIC.ctrl1 = (VIC.ctrl1 & 0xBF) | 0x20;
         VIC.ctrl2 = (VIC.ctrl2 & 0xEF);
+#endif
     } else {
         // Turn HiRes off
         // Select the bank
@@ -139,8 +172,17 @@ void plat_core_init() {
     CIA1.cra &= 0xfe;
     // CHAREN - Map characters into CPU
     *(char *)0x01 &= 0xfb;
+#ifdef C64_CHAR_BOARD
+    // The upper case font for the text, with the tile glyphs after it and in
+    // the 3 codes ASCII doesn't need
+    memcpy((char *)CHARMAP_RAM, (char *)CHARMAP_ROM, 64 * 8);
+    memcpy((char *)CHARMAP_RAM + 28 * 8, char_glyphs[0], 8);
+    memcpy((char *)CHARMAP_RAM + 30 * 8, char_glyphs[1], 2 * 8);
+    memcpy((char *)CHARMAP_RAM + 64 * 8, char_glyphs[3], 192 * 8);
+#else
     // Copy the shifted font to where the char font will live
     memcpy((char *)CHARMAP_RAM, (char *)CHARMAP_ROM + 256 * 8, 256 * 8);
+#endif
     // Unmap character rom from CPU
     *(char *)0x01 |= 0x04;
     // Turn timer back on
@@ -155,6 +197,12 @@ void plat_core_init() {
     VIC.bgcolor0 = COLOR_BLACK;
     *CHARCOLOR = COLOR_WHITE;
     plat_draw_splash_screen();
+    // The board markers, enabled by plat_draw_markers
+    VIC.spr1_color = COLOR_BLUE;        // Cursor
+    VIC.spr2_color = COLOR_GREEN;       // Selection
+    *((char*)(SCREEN_RAM+0x3f9)) = SPRITE_MARKER_BLOCK;
+    *((char*)(SCREEN_RAM+0x3fa)) = SPRITE_MARKER_BLOCK;
+    memcpy((char*)(VIC_BASE_RAM+SPRITE_MARKER_BLOCK*64), marker_sprite_data, 63);
     // Detect a mouse and install IRQ handler
     if(!mouse_setup()) {
         // Set up a pointer sprite
@@ -167,9 +215,10 @@ void plat_core_init() {
         VIC.spr_mcolor = 0;
         VIC.spr_exp_x = 0;
         VIC.spr0_color = 1;
-        *((char*)(SCREEN_RAM+0x3f8)) = 254;
-        memcpy((char*)(VIC_BASE_RAM+254*64), sprite_data, 63);
-        VIC.spr_ena = 1;
+        *((char*)(SCREEN_RAM+0x3f8)) = SPRITE_MOUSE_BLOCK;
+        memcpy((char*)(VIC_BASE_RAM+SPRITE_MOUSE_BLOCK*64), sprite_data, 63);
+        c64.sprites = 1;
+        VIC.spr_ena = c64.sprites;
         // It turns out NTSC settings work better anyway
         // if(*TV_STANDARD) {
         //     c64.tv_standard = 1;
@@ -301,7 +350,7 @@ uint8_t plat_core_mouse_to_cursor(void) {
 
     if (x >= 0 && x < BOARD_DISPLAY_WIDTH) {
         if (y >= 0 && y < BOARD_DISPLAY_HEIGHT) {
-            return (y / SQUARE_DISPLAY_HEIGHT) * 8 + (x / SQUARE_DISPLAY_WIDTH);
+            return ((y / SQUARE_DISPLAY_HEIGHT) * 8 + (x / SQUARE_DISPLAY_WIDTH)) ^ global.view.flip;
         }
     }
 
@@ -127,10 +127,32 @@ c64_t c64 = {
     {}                                 // status_log_buffer
 };
 
+// Where each square on screen is drawn, from the top left, in characters,
+// and whether it is a light square.  Looked up with position ^
+// global.view.flip
+#define SQUARE_ROW_X            1, 4, 7, 10, 13, 16, 19, 22
+#define SQUARE_ROW_Y(y)         y, y, y, y, y, y, y, y
+#define SQUARE_ROW_LIGHT(l)     l, !l, l, !l, l, !l, l, !l
+static const uint8_t square_x[64] = {
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+    SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X, SQUARE_ROW_X,
+};
+static const uint8_t square_y[64] = {
+    SQUARE_ROW_Y(0),  SQUARE_ROW_Y(3),  SQUARE_ROW_Y(6),  SQUARE_ROW_Y(9),
+    SQUARE_ROW_Y(12), SQUARE_ROW_Y(15), SQUARE_ROW_Y(18), SQUARE_ROW_Y(21),
+};
+static const bool square_light[64] = {
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+    SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0), SQUARE_ROW_LIGHT(1), SQUARE_ROW_LIGHT(0),
+};
+
 
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
 void plat_draw_char(char x, char y, unsigned rop, char c) {
+#ifdef C64_CHAR_BOARD
+    hires_text(x, y, &c, 1, rop);
+#else
     if (c >= 'A' && c <= 'Z') {
         c &= 0x7f;
     } else if (c >= 65 && c <= 90) {
@@ -139,6 +161,7 @@ void plat_draw_char(char x, char y, unsigned rop, char c) {
         c -= 96;    // Lowercase ascii to 1-26
     }
     hires_draw(x, y, 1, 1, rop, CHARMAP_RAM + c * 8);
+#endif
     hires_color(x, y, 1, 1, c64.draw_colors);
 }
 
@@ -162,6 +185,7 @@ void plat_draw_background() {
         // The menu covers part of the status area - clear it
         hires_mask(r, global.view.mc.y, x, global.view.mc.h, ROP_BLACK);
         hires_color(r, global.view.mc.y, x, global.view.mc.h, COLOR_GREEN);
+        log_invalidate(&global.view.info_panel);
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
 
@@ -181,7 +205,7 @@ void plat_draw_background() {
             r = 1 + SQUARE_TEXT_WIDTH;
             for (x = 0; x < 8; x++) {
                 if (l <= mw && r > global.view.mc.x) {
-                    plat_draw_square(i+x);
+                    plat_draw_square((i + x) ^ global.view.flip);
 
                 }
                 l += SQUARE_TEXT_WIDTH;
@@ -200,10 +224,10 @@ void plat_draw_board_accoutrements() {
     char i;
 
     c64.draw_colors = COLOR_GREEN;
-    // Add the A..H and 1..8 tile-keys
+    // Add the A..H and 1..8 tile-keys, H..A and 8..1 on a flipped board
     for (i = 0; i < 8; ++i) {
-        plat_draw_char(2 + i * SQUARE_TEXT_WIDTH, 24, ROP_CPY, i + 'A');
-        plat_draw_char(0, SCREEN_TEXT_HEIGHT - 3 - i * SQUARE_TEXT_HEIGHT, ROP_CPY, i + '1');
+        plat_draw_char(2 + i * SQUARE_TEXT_WIDTH, 24, ROP_CPY, (i ^ (global.view.flip & 7)) + 'A');
+        plat_draw_char(0, SCREEN_TEXT_HEIGHT - 3 - i * SQUARE_TEXT_HEIGHT, ROP_CPY, (i ^ (global.view.flip & 7)) + '1');
     }
 }
 
@@ -242,30 +266,13 @@ void plat_draw_clrscr() {
     hires_color(0, 0, SCREEN_TEXT_WIDTH, SCREEN_TEXT_HEIGHT, (COLOR_WHITE << 4) | COLOR_GREEN);
 }
 
-/*-----------------------------------------------------------------------*/
-void plat_draw_highlight(uint8_t position, uint8_t color) {
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-
-    if (color) {
-        hires_color(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT, 1, 3, COLOR_BLUE<<4|COLOR_BLUE);
-        hires_color(SQUARE_TEXT_WIDTH + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT, 1, 3, COLOR_BLUE<<4|COLOR_BLUE);
-    } else {
-        hires_color(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT, 1, 3, COLOR_GREEN<<4|COLOR_GREEN);
-        hires_color(SQUARE_TEXT_WIDTH + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT, 1, 3, COLOR_GREEN<<4|COLOR_GREEN);
-    }
-}
-
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i, len;
+    uint8_t offset = 0;
+    uint8_t row = log->size >= log->rows ? log->head : 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     c64.draw_colors = COLOR_BLACK << 4 | COLOR_GREEN;
@@ -277,24 +284,73 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        offset = 20 * shift;
     }
 
-    for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
+    // Only rows that changed, and only as far as there's text, or as far as
+    // the text that was there before, which the padding spaces then erase
+    for (i = 0; i < log->size; ++i, ++y) {
+        if (log->dirty[i]) {
+            len = log->used[row] > offset ? log->used[row] - offset : 0;
+            if (len > width) {
+                len = width;
+            }
+            plat_draw_text(x, y, log->buffer + row * log->cols + offset, MIN(MAX(len, log->shown[i]), width));
+            log->shown[i] = len;
+        }
+        if (++row >= log->rows) {
+            row = 0;
         }
     }
+    memset(log->dirty, 0, sizeof(log->dirty));
+}
+
+/*-----------------------------------------------------------------------*/
+// The markers are sprites 1 and 2, so moving one is a register write
+void plat_draw_markers(uint8_t cursor, uint8_t selected) {
+    uint8_t marker, position, bit;
+    unsigned char *spr_pos;
+
+    global.state.markers[MARKER_CURSOR] = cursor;
+    global.state.markers[MARKER_SELECTED] = selected;
+    for (marker = MARKER_CURSOR; marker <= MARKER_SELECTED; marker++) {
+        position = global.state.markers[marker];
+        bit = 2 << marker;
+        if (position == MARKER_NONE) {
+            c64.sprites &= ~bit;
+        } else {
+            position ^= global.view.flip;
+            spr_pos = &VIC.spr1_x + marker * 2;
+            spr_pos[0] = SPR_LEFT[c64.tv_standard] + square_x[position] * CHARACTER_WIDTH;
+            spr_pos[1] = SPR_TOP[c64.tv_standard] + square_y[position] * CHARACTER_HEIGHT + 1;
+            c64.sprites |= bit;
+        }
+    }
+    // The terminal turns the sprites off, and they go back on when it closes
+    if (!global.view.terminal_active) {
+        VIC.spr_ena = c64.sprites;
+    }
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
+#ifdef C64_CHAR_BOARD
+    // The cells have no background color of their own, so fill them in
+    if ((color >> 4) == (color & 0x0f)) {
+        hires_mask(x, y, w, h, ROP_WHITE);
+        hires_color(x, y, w, h, color);
+        return;
+    }
+#endif
     hires_mask(x, y, w, h, ROP_BLACK);
     hires_color(x, y, w, h, color);
 }
 
+/*-----------------------------------------------------------------------*/
+// Not kept on the C64 - plat_draw_background redraws what a menu covered
+void plat_draw_save_under() {
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_draw_set_color(uint8_t color) {
     c64.draw_colors = (color << 4) | (c64.draw_colors & 0x0f);
@@ -316,13 +372,13 @@ void plat_draw_splash_screen() {
     c64.draw_colors = COLOR_GREEN;
     plat_draw_text((SCREEN_TEXT_WIDTH - title2_len) / 2, SCREEN_TEXT_HEIGHT / 2 + 1, global.text.title_line2, title2_len);
 
-    hires_draw(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 - 6,
-               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, ROP_CPY,
-               hires_pieces[KING - 1][SIDE_BLACK]);
+    hires_copy(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 - 6,
+               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT,
+               BOARD_TILES[TILE_PIECE(KING, SIDE_BLACK)][0]);
     hires_color(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 - 6, SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, COLOR_GREEN);
-    hires_draw(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 + 4,
-               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, ROP_CPY,
-               hires_pieces[KING - 1][SIDE_WHITE]);
+    hires_copy(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 + 4,
+               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT,
+               BOARD_TILES[TILE_PIECE(KING, SIDE_WHITE)][0]);
     hires_color(SCREEN_TEXT_WIDTH / 2 - 2, SCREEN_TEXT_HEIGHT / 2 + 6, SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, COLOR_WHITE << 4 | COLOR_GREEN);
 
     plat_core_key_wait_any();
@@ -334,26 +390,17 @@ void plat_draw_splash_screen() {
 /*-----------------------------------------------------------------------*/
 // Draw a tile with background and piece on it for positions 0..63
 void plat_draw_square(uint8_t position) {
-    unsigned rop;
-    uint8_t inv;
-    uint8_t y = position / 8;
-    uint8_t x = position & 7;
-    uint8_t piece = fics_letter_to_piece(global.state.chess_board[position]);
-    bool black_or_white = !((x & 1) ^ (y & 1));
-
-    if (piece) {
-        rop = black_or_white ? ROP_INV : ROP_CPY;
-        inv = black_or_white ^ !((piece & PIECE_WHITE) == 0);
-    } else {
-        rop = black_or_white ? ROP_WHITE : ROP_BLACK;
-        inv = 0;
-        piece = 1;
-    }
+    uint8_t tile;
+    uint8_t square = position ^ global.view.flip;
+    uint8_t piece = global.state.chess_board[position];
+
+    global.state.drawn_board[position] = piece;
 
-    hires_draw(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT,
-               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, rop,
-               hires_pieces[(piece & 127) - 1][inv]);
-    hires_color(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT,
+    tile = piece ? TILE_PIECE(piece & ~PIECE_WHITE, (piece & PIECE_WHITE) ? SIDE_WHITE : SIDE_BLACK) : TILE_EMPTY;
+    hires_copy(square_x[square], square_y[square],
+               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT,
+               BOARD_TILES[tile][square_light[square]]);
+    hires_color(square_x[square], square_y[square],
                 SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, COLOR_WHITE<<4);
 }
 
@@ -372,10 +419,9 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
             cputc(c);
         }
     } else {
-        while (len) {
-            plat_draw_char(x++, y, ROP_CPY, *text);
-            len--;
-            text++;
+        if (len) {
+            hires_text(x, y, text, len, ROP_CPY);
+            hires_color(x, y, len, 1, c64.draw_colors);
         }
     }
 }
@@ -407,5 +453,18 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 }
 
 /*-----------------------------------------------------------------------*/
+// The main loop comes back around to app_draw_update, so if that has
+// drawing to do, let it start as the raster leaves the bottom text row.
+// The wait is for the raster to be anywhere from line 251, through the
+// lines past 255 ($D011 bit 7) and the top border, to line 50.  That is
+// about 110 lines on PAL and 60 on NTSC, so an interrupt would have to run
+// for thousands of cycles to make it miss a frame
+#define RASTER_IN_BORDER()  ((VIC.ctrl1 & 0x80) || VIC.rasterline >= 251 || VIC.rasterline < 51)
 void plat_draw_update() {
+    if (app_draw_pending()) {
+        while (RASTER_IN_BORDER()) {
+        }
+        while (!RASTER_IN_BORDER()) {
+        }
+    }
 }
@@ -12,6 +12,11 @@
 #include <ctype.h>  // is*
 
 #include "global.h"
+#include "ficsmatch.h"
+
+#ifdef RETROMATE_HOST
+#include "host/platHost.h"
+#endif
 
 // This files has strings and characters encoded as hex, not as ' ' or "".  That is
 // because what comes from the server is ASCII but the target platforms aren't all ASCII.
@@ -21,32 +26,15 @@
 // Triggers in the match callback
                                     // "login:"
 #define FICS_TRIGGER_LOGIN          "\x6C\x6F\x67\x69\x6e\x3a"
-                                    // "enter the server as \""
-#define FICS_TRIGGER_LOGGED_IN      "\x65\x6e\x74\x65\x72\x20\x74\x68\x65\x20\x73\x65\x72\x76\x65\x72\x20\x61\x73\x20\x22"
                                     // "increment set to"
 #define FICS_TRIGGER_MIN_SET        "\x69\x6e\x63\x72\x65\x6d\x65\x6e\x74\x20\x73\x65\x74\x20\x74\x6f"
                                     // "(http://www.freechess.org)."
 #define FICS_TRIGGER_CLOSED_URL     "\x28\x68\x74\x74\x70\x3a\x2f\x2f\x77\x77\x77\x2e\x66\x72\x65\x65\x63\x68\x65\x73\x73\x2e\x6f\x72\x67\x29\x2e"
 
-// Triggers in the data callback
+// Triggers in the data callbacks are matched with the tables in ficsmatch.h
+// (generated by util/genmatch.py).  This one is only checked after "{Game "
                                     // "Creating"
 #define FICS_DATA_CREATING          "\x43\x72\x65\x61\x74\x69\x6e\x67"
-                                    // "{Game "
-#define FICS_DATA_GAME_OVER         "\x7b\x47\x61\x6d\x65\x20"
-                                    // "<12>"
-#define FICS_DATA_STYLE12           "\x3c\x31\x32\x3e"
-                                    // "says: "
-#define FICS_DATA_SAYS              "\x73\x61\x79\x73\x3a\x20"
-                                    // "Removing game"
-#define FICS_DATA_REMOVING          "\x52\x65\x6d\x6f\x76\x69\x6e\x67\x20\x67\x61\x6d\x65"
-                                    // "nor examining a game."
-#define FICS_DATA_QUIESCENCE        "\x6e\x6f\x72\x20\x65\x78\x61\x6d\x69\x6e\x69\x6e\x67\x20\x61\x20\x67\x61\x6d\x65\x2e"
-                                    // "password:"
-#define FICS_DATA_PASSWORD          "\x70\x61\x73\x73\x77\x6f\x72\x64\x3a"
-                                    // "Starting FICS"
-#define FICS_DATA_REGISTERED        "\x53\x74\x61\x72\x74\x69\x6e\x67\x20\x46\x49\x43\x53"
-                                    // "Invalid password!"
-#define FICS_DATA_BAD_PASSWORD      "\x49\x6e\x76\x61\x6c\x69\x64\x20\x70\x61\x73\x73\x77\x6f\x72\x64\x21"
 
 // Commands that are sent (are in platform format) and get converted to ASCII
 // before being sent (by plat_net_send)
@@ -56,9 +44,24 @@
 #define FICS_CMD_S12REFRESH         "set style 12\nrefresh"
 #define FICS_CMD_SOUGHT             "sought"
 
+// Telnet command bytes
+#define TELNET_SE                   0xF0
+#define TELNET_SB                   0xFA
+#define TELNET_WILL                 0xFB
+#define TELNET_DONT                 0xFE
+#define TELNET_IAC                  0xFF
+
+// States for fics_telnet_filter.  These persist across reads
+enum {
+    TS_DATA,                        // Plain text
+    TS_IAC,                         // After IAC
+    TS_OPTION,                      // After IAC WILL/WONT/DO/DONT, the option follows
+    TS_SUB,                         // In a subnegotiation (IAC SB ... IAC SE)
+    TS_SUB_IAC,                     // After IAC inside a subnegotiation
+};
+
 enum {
     FS_STATUS_OKAY,
-    FS_STATUS_NEXTLINE,
     FS_STATUS_DONE,
     FS_STATUS_NO_MATCH,
     FS_STATUS_ERROR,
@@ -71,7 +74,9 @@ fics_data_t fics_data = {
     0,
     {},
     {},
-    ""
+    {},
+    0,
+    0
 };
 
 // Forward declare
@@ -91,42 +96,148 @@ static void fics_add_status_log(const char *str1, const char *str2) {
 }
 
 
+/*-----------------------------------------------------------------------*/
+// Write value as ASCII digits to dest and return the end of the digits
+static char *fics_utoa(char *dest, unsigned int value) {
+    if (value >= 10) {
+        dest = fics_utoa(dest, value / 10);
+    }
+    *dest++ = '\x30' + value % 10;  // '0'
+    *dest = '\0';
+    return dest;
+}
+
+/*-----------------------------------------------------------------------*/
+static void fics_add_status_number(const char *str1, int value) {
+    char text[7];
+    char *ptr = text;
+    if (value < 0) {
+        *ptr++ = '\x2d';    // '-'
+        value = -value;
+    }
+    fics_utoa(ptr, value);
+    fics_add_status_log(str1, text);
+}
+
+/*-----------------------------------------------------------------------*/
+// Show a clock as m:ss
+static void fics_add_status_time(int seconds) {
+    char text[8];
+    char *ptr = text;
+    if (seconds < 0) {
+        *ptr++ = '\x2d';    // '-'
+        seconds = -seconds;
+    }
+    ptr = fics_utoa(ptr, seconds / 60);
+    *ptr++ = '\x3a';        // ':'
+    *ptr++ = '\x30' + (seconds % 60) / 10;
+    *ptr++ = '\x30' + seconds % 10;
+    *ptr = '\0';
+    fics_add_status_log(global.text.word_time, text);
+}
+
 /*-----------------------------------------------------------------------*/
 static void fics_add_stats(bool side) {
     if (side) { // white
         fics_add_status_log(global.text.word_spaces, global.text.side_label[SIDE_WHITE]);
         fics_add_status_log("", global.frame.w_name);
-        fics_add_status_log(global.text.word_strength, global.frame.w_strength);
-        fics_add_status_log(global.text.word_time, global.frame.w_remaining_time);
+        fics_add_status_number(global.text.word_strength, global.frame.w_strength);
+        fics_add_status_time(global.frame.w_remaining_time);
     } else {    // Black
         fics_add_status_log(global.text.word_spaces, global.text.side_label[SIDE_BLACK]);
         fics_add_status_log("", global.frame.b_name);
-        fics_add_status_log(global.text.word_strength, global.frame.b_strength);
-        fics_add_status_log(global.text.word_time, global.frame.b_remaining_time);
+        fics_add_status_number(global.text.word_strength, global.frame.b_strength);
+        fics_add_status_time(global.frame.b_remaining_time);
     }
     log_add_line(&global.view.info_panel, "\x0a", 1);
 }
 
+/*-----------------------------------------------------------------------*/
+// Skip the rest of this field, and the spaces after it
+static const char *fics_next_field(const char *src, const char *end) {
+    while (src < end && *src != '\x20') {  // ' '
+        src++;
+    }
+    while (src < end && *src == '\x20') {
+        src++;
+    }
+    return src;
+}
 
+/*-----------------------------------------------------------------------*/
+// Read a (possibly negative) number and move to the next field
+static const char *fics_read_int(const char *src, const char *end, int *value) {
+    bool negative = false;
+    int number = 0;
+    if (src < end && *src == '\x2d') {   // '-'
+        negative = true;
+        src++;
+    }
+    while (src < end && *src >= '\x30' && *src <= '\x39') {
+        number = number * 10 + (*src++ - '\x30');
+    }
+    *value = negative ? -number : number;
+    return fics_next_field(src, end);
+}
 
 /*-----------------------------------------------------------------------*/
-// Copy out data from src, up to the next ' ' in src, or till max_len
-// copied out. Advance src to after the ' ' character (even if max_len was
-// copied and no ' ' was found)
-static const char *fics_copy_data(char *dest, const char *src, uint8_t max_len) {
-    while (max_len) {
-        if (*src != '\x20') {   // ' '
-            *dest++ = *src++;
-            max_len--;
-        } else {
-            break;
-        }
+// Copy at most max_len characters of a field to dest, and move to the next field
+static const char *fics_read_word(char *dest, const char *src, const char *end, uint8_t max_len) {
+    while (max_len && src < end && *src != '\x20') {
+        *dest++ = *src++;
+        max_len--;
     }
     *dest = '\0';
-    while (*src != '\x20') {
+    return fics_next_field(src, end);
+}
+
+/*-----------------------------------------------------------------------*/
+// Decode the fields of a style 12 line, after the "<12> ", into global.frame.
+// Returns false if the line is too short to hold a board
+static bool fics_decode_style12(const char *src, const char *end) {
+    uint8_t i, j;
+    int value;
+    uint8_t *board = global.frame.board;
+
+    if (end - src < 8 * 9) {
+        return false;
+    }
+    for (i = 0; i < 8; i++) {
+        for (j = 0; j < 8; j++) {
+            *board++ = fics_letter_to_piece(*src++);
+        }
         src++;
     }
-    return ++src;
+
+    global.frame.flags = 0;
+    if (*src == '\x57') {  // 'W'
+        global.frame.flags |= FRAME_WHITE_TO_MOVE;
+    }
+    src = fics_next_field(src, end);
+    src = fics_read_int(src, end, &value);
+    global.frame.double_pawn_push = value;
+    for (i = FRAME_W_CAN_CASTLE_L; i <= FRAME_B_CAN_CASTLE_S; i <<= 1) {
+        src = fics_read_int(src, end, &value);
+        if (value) {
+            global.frame.flags |= i;
+        }
+    }
+    src = fics_read_int(src, end, &value);
+    global.frame.moves_since_irreversible = value > 255 ? 255 : value;
+    src = fics_read_int(src, end, &global.frame.game_number);
+    src = fics_read_word(global.frame.w_name, src, end, sizeof(global.frame.w_name) - 1);
+    src = fics_read_word(global.frame.b_name, src, end, sizeof(global.frame.b_name) - 1);
+    src = fics_read_int(src, end, &value);
+    global.frame.my_relation_to_game = value;
+    src = fics_read_int(src, end, &global.frame.initial_time);
+    src = fics_read_int(src, end, &global.frame.time_increment);
+    src = fics_read_int(src, end, &global.frame.w_strength);
+    src = fics_read_int(src, end, &global.frame.b_strength);
+    src = fics_read_int(src, end, &global.frame.w_remaining_time);
+    src = fics_read_int(src, end, &global.frame.b_remaining_time);
+    src = fics_read_int(src, end, &global.frame.move_number);
+    fics_read_word(global.frame.previous_move, src, end, sizeof(global.frame.previous_move) - 1);
+    return true;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -139,7 +250,7 @@ static void fics_format_stats_message(const char *message, int len, char delimit
     global.view.info_panel.size = global.view.info_panel.head = FICS_STATSLOG_MSG_ROW;
     // And also updating the dest ptr
     global.view.info_panel.dest_ptr = global.view.info_panel.buffer + (FICS_STATSLOG_MSG_ROW * global.view.info_panel.cols);
-    plat_draw_clear_statslog_area(FICS_STATSLOG_MSG_ROW);
+    app_draw_clear_statslog(FICS_STATSLOG_MSG_ROW);
 
     while (1) { // or start_message != \n or } maybe?
         while (len && *message != '\x20' && *message != delimiter) { // ' '
@@ -218,15 +329,9 @@ static void fics_next_number() {
             fics_data.parse_point++;
     }
 
-    if(fics_data.length) {
-        // Set up the length
-        fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
-        fics_data.parse_state++;
-    } else {
-        // This is a serious issue - this record is split - I don't really deal with that
-        // So skip till a newline and this record will just be ignored
-        fics_data.status = FS_STATUS_NEXTLINE;
-    }
+    // Lines arrive whole, so running out of data also ends the number
+    fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
+    fics_data.parse_state++;
 }
 
 
@@ -257,33 +362,153 @@ static void fics_next_word() {
             fics_data.parse_point++;
     }
 
-    if(fics_data.length) {
-        // set the length
-        fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
-        fics_data.parse_state++;
-    } else {
-        // This is a serious issue - this record is split - I don't really deal with that
-        // So skip till a newline and this record will just be ignored
-        fics_data.status = FS_STATUS_NEXTLINE;
+    // Lines arrive whole, so running out of data also ends the word
+    fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
+    fics_data.parse_state++;
+}
+
+/*-----------------------------------------------------------------------*/
+// Find the first data trigger in a line, looking at every byte only once.
+// Triggers FICS only sends at the start of a line are checked there and
+// nowhere else.  Returns the FICS_MATCH_* found and sets match_end to just
+// past the trigger text
+static uint8_t fics_match_line(const char *line, int len, const char **match_end) {
+    const char *end = line + len;
+    uint8_t state, next, c;
+
+    // Skip the \r that FICS sends after each \n
+    while (line < end && *line == '\x0d') {
+        line++;
+    }
+
+    // Walk the anchored trie from the start of the line
+    state = FICS_MATCH_ANCHOR_ROOT;
+    *match_end = line;
+    while (*match_end < end) {
+        c = **match_end;
+        next = fics_match_child[state];
+        while (next && fics_match_char[next] != c) {
+            next = fics_match_sibling[next];
+        }
+        if (!next) {
+            break;
+        }
+        state = next;
+        (*match_end)++;
+        if (fics_match_out[state]) {
+            return fics_match_out[state];
+        }
     }
+
+    // Run the rest through the Aho-Corasick automaton
+    state = FICS_MATCH_ROOT;
+    while (line < end) {
+        c = *line++;
+        while (1) {
+            if (state == FICS_MATCH_ROOT) {
+                state = c < sizeof(fics_match_first) ? fics_match_first[c] : FICS_MATCH_ROOT;
+                break;
+            }
+            next = fics_match_child[state];
+            while (next && fics_match_char[next] != c) {
+                next = fics_match_sibling[next];
+            }
+            if (next) {
+                state = next;
+                break;
+            }
+            state = fics_match_fail[state];
+        }
+        if (fics_match_out[state]) {
+            *match_end = line;
+            return fics_match_out[state];
+        }
+    }
+    return FICS_MATCH_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+// Look for trigger_text in buf, carrying on from where the previous read
+// left off, so a trigger split over two reads is still found.  Returns a
+// pointer just past the end of the trigger, or NULL if it's not (yet) seen
+static const char *fics_trigger_match(const char *buf, int len) {
+    const char *text = global.fics.trigger_text;
+    uint8_t state = global.fics.trigger_state;
+    char c;
+
+    while (len--) {
+        c = *buf++;
+        while (state && c != text[state]) {
+            state = global.fics.trigger_fail[state - 1];
+        }
+        if (c == text[state] && ++state == global.fics.trigger_length) {
+            global.fics.trigger_state = 0;
+            return buf;
+        }
+    }
+    global.fics.trigger_state = state;
+    return NULL;
+}
+
+/*-----------------------------------------------------------------------*/
+// While logging in, a line that ends in ": " is a prompt (password:, Press
+// return to enter the server as "...":) and the server sends nothing more
+// until it gets a reply.  Once logged in, ": " is just where a read ended,
+// e.g. in "... says: ", so the line waits for its newline
+static bool fics_line_is_prompt(const char *line, int len) {
+    return global.app.state == APP_STATE_OFFLINE &&
+           len >= 2 && line[len - 2] == '\x3a' && line[len - 1] == '\x20'; // ':' ' '
 }
 
 /*-----------------------------------------------------------------------*/
-static const char *fics_strnstr(const char *haystack, int haystack_length, const char *needle) {
-    int j, i = 0;
-    while (i < haystack_length) {
-        if (haystack[i] == *needle) {
-            j = 1;
-            while (needle[j] && haystack[i + j] == needle[j]) {
-                j++;
+// Split incoming data into lines so the data callback only ever sees whole
+// records.  Lines that arrive complete are handed out straight from buf.
+// Only a line that straddles network reads is copied into line_buffer, where
+// it waits to be completed by the next read.  Returns how much of buf was
+// used, which is less than len if a callback installed a trigger
+static int fics_line_feed(const char *buf, int len) {
+    const char *start = buf;
+    const char *line_end;
+    int line_len, space;
+
+    while (len > 0) {
+        if (global.fics.match_callback) {
+            // A callback installed a trigger, which now owns the stream
+            global.fics.line_length = 0;
+            break;
+        }
+
+        line_end = memchr(buf, '\x0a', len); // '\n'
+        line_len = line_end ? line_end - buf + 1 : len;
+
+        if (!global.fics.line_length && (line_end || line_len >= FICS_LINE_MAX || fics_line_is_prompt(buf, line_len))) {
+            // The whole line is in buf - no copy needed
+            if (global.fics.new_data_callback) {
+                (*global.fics.new_data_callback)(buf, line_len);
             }
-            if (!needle[j]) {
-                return haystack + i;
+        } else {
+            // Append to the partial line.  If it can't all fit, the line is
+            // passed on as is, and the rest is treated as a new line
+            space = FICS_LINE_MAX - global.fics.line_length;
+            if (line_len > space) {
+                line_len = space;
+            }
+            memcpy(global.fics.line_buffer + global.fics.line_length, buf, line_len);
+            global.fics.line_length += line_len;
+            if (global.fics.line_buffer[global.fics.line_length - 1] == '\x0a' ||
+                    global.fics.line_length == FICS_LINE_MAX ||
+                    fics_line_is_prompt(global.fics.line_buffer, global.fics.line_length)) {
+                space = global.fics.line_length;
+                global.fics.line_length = 0;
+                if (global.fics.new_data_callback) {
+                    (*global.fics.new_data_callback)(global.fics.line_buffer, space);
+                }
             }
         }
-        i++;
+        buf += line_len;
+        len -= line_len;
     }
-    return 0;
+    return buf - start;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -329,49 +554,44 @@ static void fics_tcb_online(const char *buf, int len, const char *match) {
 static void fics_ndcb_login_flow(const char *buf, int len) {
     bool login_error = false;
     const char *error_string;
-    const char *parse_point = buf;
-    while (len > 0) {
-        char character = *parse_point;
-        if (character == FICS_DATA_PASSWORD[0] && 0 == strncmp(parse_point, FICS_DATA_PASSWORD, (sizeof(FICS_DATA_PASSWORD) - 1))) {
+    const char *match_end;
+
+    switch (fics_match_line(buf, len, &match_end)) {
+        case FICS_MATCH_PASSWORD:
             if (ui_pregame_menu_options_menu.menu_items[UI_LOGIN_OPTIONS_REGISTERED].selected == 1) {
                 // Prompting for a password on a registered account
                 plat_net_send(global.ui.user_password);
             } else {
                 login_error = 1;
                 error_string = "Registered account";
-                break;
             }
+            break;
 
-
-        } else if (character == FICS_DATA_REGISTERED[0] && 0 == strncmp(parse_point, FICS_DATA_REGISTERED, (sizeof(FICS_DATA_REGISTERED) - 1))) {
+        case FICS_MATCH_REGISTERED:
             // Login as registered user a success, go to online init
             fics_set_trigger_callback(FICS_TRIGGER_MIN_SET, fics_tcb_online);
             app_set_state(APP_STATE_ONLINE_INIT);
+            break;
 
-
-
-        } else if (character == FICS_DATA_BAD_PASSWORD[0] && 0 == strncmp(parse_point, FICS_DATA_BAD_PASSWORD, (sizeof(FICS_DATA_BAD_PASSWORD) - 1))) {
+        case FICS_MATCH_BAD_PASSWORD:
             // Password wasn't accepted
             login_error = true;
             error_string = "Invalid password";
             break;
 
-
-
-
-        } else if (character == FICS_TRIGGER_LOGGED_IN[0] && 0 == strncmp(parse_point, FICS_TRIGGER_LOGGED_IN, (sizeof(FICS_TRIGGER_LOGGED_IN) - 1))) {
+        case FICS_MATCH_LOGGED_IN:
             if (ui_pregame_menu_options_menu.menu_items[UI_LOGIN_OPTIONS_REGISTERED].selected == 1) {
                 // User name isn't registered, but was available, but that's not what the user wanted, so go offline
                 login_error = true;
                 error_string = "Not a registered account";
-                break;
             } else {
                 fics_set_trigger_callback(FICS_TRIGGER_MIN_SET, fics_tcb_online);
                 app_set_state(APP_STATE_ONLINE_INIT);
             }
-        }
-        len--;
-        parse_point++;
+            break;
+
+        default:
+            break;
     }
 
     if (login_error) {
@@ -383,14 +603,49 @@ static void fics_ndcb_login_flow(const char *buf, int len) {
 }
 
 /*-----------------------------------------------------------------------*/
-static void fics_ndcb_sought_list(const char *buf, int len) {
-    if(fics_data.status == FS_STATUS_NEXTLINE) {
-        while(len && '\x0a' != *buf) {  // '\n'
-            len--;
-            buf++;
+// Keep the sought game in the current line if it's one of the closest
+// FICS_SOUGHT_CANDIDATES rating matches seen so far
+static void fics_add_candidate(uint16_t delta) {
+    fics_candidate_t *candidate;
+    uint8_t i = fics_data.num_candidates;
+    uint8_t len = fics_data.sought_word_len[SOUGHT_GAME_NUM];
+
+    if (len >= sizeof(candidate->game_number_str)) {
+        return;
+    }
+    // Insertion sort - move worse matches down, dropping the last when full
+    if (i == FICS_SOUGHT_CANDIDATES) {
+        if (delta >= fics_data.candidate[i - 1].rating_delta) {
+            return;
         }
-        fics_data.parse_state = SOUGHT_GAME_NUM;
+        i--;
+    } else {
+        fics_data.num_candidates++;
     }
+    while (i && delta < fics_data.candidate[i - 1].rating_delta) {
+        fics_data.candidate[i] = fics_data.candidate[i - 1];
+        i--;
+    }
+    candidate = &fics_data.candidate[i];
+    candidate->rating_delta = delta;
+    memcpy(candidate->game_number_str, fics_data.sought_word[SOUGHT_GAME_NUM], len);
+    candidate->game_number_str[len] = '\0';
+}
+
+/*-----------------------------------------------------------------------*/
+// Ask to play the next best sought game.  Returns false when there are none left
+static bool fics_play_next_candidate() {
+    if (fics_data.next_candidate >= fics_data.num_candidates) {
+        return false;
+    }
+    strcpy(global.view.scratch_buffer, FICS_CMD_PLAY);
+    strcat(global.view.scratch_buffer, fics_data.candidate[fics_data.next_candidate++].game_number_str);
+    plat_net_send(global.view.scratch_buffer);
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+static void fics_ndcb_sought_list(const char *buf, int len) {
     fics_data.status = FS_STATUS_OKAY;
     fics_data.parse_point = buf;
     fics_data.length = len;
@@ -404,7 +659,7 @@ static void fics_ndcb_sought_list(const char *buf, int len) {
             case SOUGHT_RANKING:
                 fics_next_number();
                 if(!fics_data.sought_word_len[SOUGHT_RANKING]) {
-                    if(fics_data.game_number_str[0]) {
+                    if(fics_data.num_candidates) {
                         fics_data.status = FS_STATUS_DONE;
                     } else {
                         fics_data.status = FS_STATUS_NO_MATCH;
@@ -465,7 +720,7 @@ static void fics_ndcb_sought_list(const char *buf, int len) {
                         // keep at extra
                         fics_data.parse_state = SOUGHT_EXTRA;
                     } else {
-                        uint16_t rating, delta;
+                        uint16_t rating;
 
                         // Reset for the next line
                         fics_data.parse_state = SOUGHT_GAME_NUM;
@@ -491,14 +746,9 @@ static void fics_ndcb_sought_list(const char *buf, int len) {
                             break;
                         }
 
-                        // See if this offer is closer to my rating
+                        // Rank this offer by how close it is to my rating
                         rating = atoi(fics_data.sought_word[SOUGHT_RANKING]);
-                        delta = abs(rating - global.ui.my_rating);
-                        if (delta < fics_data.rating_delta && fics_data.sought_word_len[SOUGHT_GAME_NUM] < sizeof(fics_data.game_number_str) - 1) {
-                            fics_data.rating_delta = delta;
-                            strncpy(fics_data.game_number_str, fics_data.sought_word[SOUGHT_GAME_NUM], fics_data.sought_word_len[SOUGHT_GAME_NUM]);
-                            fics_data.game_number_str[fics_data.sought_word_len[SOUGHT_GAME_NUM]] = '\0';
-                        }
+                        fics_add_candidate(abs(rating - global.ui.my_rating));
                         break;
                     }
                 }
@@ -509,9 +759,8 @@ static void fics_ndcb_sought_list(const char *buf, int len) {
     switch(fics_data.status) {
         case FS_STATUS_DONE:
             fics_set_new_data_callback(fics_ndcb_update_from_server);
-            strcpy(global.view.scratch_buffer, FICS_CMD_PLAY);
-            strcat(global.view.scratch_buffer, fics_data.game_number_str);
-            plat_net_send(global.view.scratch_buffer);
+            // If this game is gone, FICS_MATCH_SEEK_GONE tries the next one
+            fics_play_next_candidate();
             // Asking for the game - may not start though so re-enable the menu
             ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_ENABLED;
         break;
@@ -529,17 +778,15 @@ static void fics_ndcb_sought_list(const char *buf, int len) {
 
 /*-----------------------------------------------------------------------*/
 static void fics_ndcb_update_from_server(const char *buf, int len) {
-    const char *parse_point = buf;
+    const char *end = buf + len;
+    const char *parse_point;
     const char *parse_start;
-    while (len > 0) {
-        char character = *parse_point;
-        if (character == FICS_DATA_STYLE12[0] && 0 == strncmp(parse_point, FICS_DATA_STYLE12, (sizeof(FICS_DATA_STYLE12) - 1))) {
+
+    switch (fics_match_line(buf, len, &parse_point)) {
+        case FICS_MATCH_STYLE12:
             // In a style 12 game
-            uint8_t i;
-            char *cb = global.state.chess_board;
-            parse_start = parse_point;
             global.state.game_active = true;
-            parse_point += 5;
+            parse_point++;
             if (*parse_point == '\x49') { // 'I'
                 // Illegal move - let's get the state back
                 // I could keep a pre-move state and reinstate that, or just do this.
@@ -547,53 +794,45 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                 plat_net_send(FICS_CMD_REFRESH);
                 return;
             }
-            global.view.refresh = true;
-            for (i = 0; i < 8; i++) {
-                strncpy(cb, parse_point, 8);
-                cb += 8;
-                parse_point += 9;
+            if (!fics_decode_style12(parse_point, end)) {
+                break;
             }
-            parse_point = fics_copy_data(global.frame.color_to_move, parse_point, 1);
-            parse_point = fics_copy_data(global.frame.double_pawn_push, parse_point, 2);
-            parse_point = fics_copy_data(global.frame.w_can_castle_l, parse_point, 1);
-            parse_point = fics_copy_data(global.frame.w_can_castle_s, parse_point, 1);
-            parse_point = fics_copy_data(global.frame.b_can_castle_l, parse_point, 1);
-            parse_point = fics_copy_data(global.frame.b_can_castle_s, parse_point, 1);
-            parse_point = fics_copy_data(global.frame.moves_since_irreversible, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.game_number, parse_point, 6);
-            parse_point = fics_copy_data(global.frame.w_name, parse_point, 18);
-            parse_point = fics_copy_data(global.frame.b_name, parse_point, 18);
-            parse_point = fics_copy_data(global.frame.my_relation_to_game, parse_point, 2);
-            parse_point = fics_copy_data(global.frame.initial_time, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.time_increment, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.w_strength, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.b_strength, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.w_remaining_time, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.b_remaining_time, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.move_number, parse_point, 3);
-            parse_point = fics_copy_data(global.frame.previous_move, parse_point, 7);
-
-            // '1'
-            global.state.includes_me = global.frame.my_relation_to_game[0] == '\x31' || global.frame.my_relation_to_game[1] == '\x31';
-            global.state.my_move = global.frame.my_relation_to_game[0] == '\x31';
+            // app_draw_update compares this with drawn_board and redraws only the changes
+            memcpy(global.state.chess_board, global.frame.board, sizeof(global.state.chess_board));
+            global.view.board_changed = true;
+#ifdef RETROMATE_HOST
+            // The host build reports every board, for replay comparisons
+            host_frame_decoded();
+#endif
+
+            global.state.includes_me = global.frame.my_relation_to_game == 1 || global.frame.my_relation_to_game == -1;
+            global.state.my_move = global.frame.my_relation_to_game == 1;
 
             if (!global.state.includes_me) {
                 global.state.my_side = SIDE_WHITE;
             } else {
                 // Derive my color based on whether it's my move or not
-                // 'W'
-                global.state.my_side = global.state.my_move ? *global.frame.color_to_move == '\x57' : *global.frame.color_to_move != '\x57';
+                global.state.my_side = global.state.my_move == !!(global.frame.flags & FRAME_WHITE_TO_MOVE);
                 if (global.state.cursor < 0) {
                     global.state.cursor = global.state.my_side ? 51 : 12;
                 }
             }
+            // Show my side at the bottom of the board
+            if (global.view.flip != (global.state.my_side == SIDE_BLACK ? BOARD_FLIPPED : 0)) {
+                // Take the markers off while they are still where the squares were
+                plat_draw_markers(MARKER_NONE, MARKER_NONE);
+                global.view.flip ^= BOARD_FLIPPED;
+                global.view.refresh = true;
+            }
             if (ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state == MENU_STATE_ENABLED ||
                     ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state == MENU_STATE_ENABLED) {
                 if (global.view.info_panel.size > FICS_STATSLOG_MSG_ROW) {
-                    plat_draw_clear_statslog_area(FICS_STATSLOG_MSG_ROW);
+                    app_draw_clear_statslog(FICS_STATSLOG_MSG_ROW);
                 }
                 ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_HIDDEN;
                 ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state = MENU_STATE_HIDDEN;
+                // A game started, so don't fall back to other sought games
+                fics_data.num_candidates = 0;
                 if (global.state.includes_me) {
                     ui_in_game_menu.menu_items[UI_MENU_INGAME_RESIGN].item_state = MENU_STATE_ENABLED;
                 } else {
@@ -601,32 +840,23 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                 }
             }
             log_clear(&global.view.info_panel);
-            fics_add_status_log(global.text.game_number, global.frame.game_number);
+            fics_add_status_number(global.text.game_number, global.frame.game_number);
             log_add_line(&global.view.info_panel, "\x0a", 1); // '\n'
             fics_add_stats(global.state.my_side);
             fics_add_stats(global.state.my_side ^ 1);
-            // 'W'
-            fics_add_status_log(global.text.word_next, *global.frame.color_to_move == '\x57' ? global.text.side_label[SIDE_WHITE] : global.text.side_label[SIDE_BLACK]);
+            fics_add_status_log(global.text.word_next, global.text.side_label[global.frame.flags & FRAME_WHITE_TO_MOVE ? SIDE_WHITE : SIDE_BLACK]);
             fics_add_status_log(global.text.word_last, global.frame.previous_move);
+            break;
 
-            // Move past all this to see if there are more statements to parse (Game Over comes with last
-            // move in all cases I observed)
-            len -= (parse_point - parse_start);
-            while (len && *parse_point != '\x0a') { // '\n'
-                parse_point++;
-                len--;
-            }
-        } else if (character == FICS_DATA_GAME_OVER[0] && 0 == strncmp(parse_point, FICS_DATA_GAME_OVER, (sizeof(FICS_DATA_GAME_OVER) - 1))) {
+        case FICS_MATCH_GAME_OVER:
             // Game status message received
-            global.view.refresh = true;
             // Skip user names
-            while (len && *parse_point != '\x29') { // ')'
+            while (parse_point < end && *parse_point != '\x29') { // ')'
                 parse_point++;
-                len--;
             }
             // Skip ) & space
             parse_point += 2;
-            len -= 2;
+            len = end - parse_point;
             if (len > 0) {
                 // If it's a Creating message, it's still game-on
                 if (!(*parse_point == FICS_DATA_CREATING[0] && 0 == strncmp(parse_point, FICS_DATA_CREATING, (sizeof(FICS_DATA_CREATING) - 1)))) {
@@ -637,14 +867,27 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                 fics_format_stats_message(parse_point, len, '\x7d'); // '}'
             }
             // Force a refresh to see what menu item states should be active
-            // Only if I was in the game.  Observe will refresh in FICS_DATA_REMOVING
+            // Only if I was in the game.  Observe will refresh in FICS_MATCH_REMOVING
             if(global.state.includes_me) {
                 plat_net_send(FICS_CMD_REFRESH);
             }
-        } else if (character == FICS_DATA_REMOVING[0] && 0 == strncmp(parse_point, FICS_DATA_REMOVING, (sizeof(FICS_DATA_REMOVING) - 1))) {
+            break;
+
+        case FICS_MATCH_REMOVING:
             // Force a refresh to see what menu item states should be active
             plat_net_send(FICS_CMD_REFRESH);
-        } else if (character == FICS_DATA_QUIESCENCE[0] && 0 == strncmp(parse_point, FICS_DATA_QUIESCENCE, (sizeof(FICS_DATA_QUIESCENCE) - 1))) {
+            break;
+
+        case FICS_MATCH_SEEK_GONE:
+            // The sought game was taken before "play" got there - try the next
+            // best, and if they are all gone, seek a game as with no match
+            if (fics_data.num_candidates && !fics_play_next_candidate()) {
+                fics_data.num_candidates = 0;
+                fics_play(true);
+            }
+            break;
+
+        case FICS_MATCH_QUIESCENCE:
             ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_ENABLED;
             ui_in_game_menu.menu_items[UI_MENU_INGAME_RESIGN].item_state = MENU_STATE_HIDDEN;
             ui_in_game_menu.menu_items[UI_MENU_INGAME_UNOBSERVE].item_state = MENU_STATE_HIDDEN;
@@ -652,27 +895,29 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
             if (global.view.mc.m && !(global.view.mc.df & MENU_DRAW_HIDDEN)) {
                 global.view.mc.df = MENU_DRAW_REDRAW;
             }
-        } else if (character == FICS_DATA_SAYS[0] && 0 == strncmp(parse_point, FICS_DATA_SAYS, (sizeof(FICS_DATA_SAYS) - 1))) {
+            break;
+
+        case FICS_MATCH_SAYS:
             // says: received - show what was said
-            parse_point += (sizeof(FICS_DATA_SAYS) - 1);
-            len -= (sizeof(FICS_DATA_SAYS) - 1);
             parse_start = parse_point;
-            while (len && *parse_point != '\x0a') { // '\n'
-                len--;
+            while (parse_point < end && *parse_point != '\x0a') { // '\n'
                 parse_point++;
             }
-            if (*parse_point == '\x0a') {
+            if (parse_point < end) {
                 fics_format_stats_message(parse_start, parse_point - parse_start, '\x0a');
-                global.view.refresh = true;
             }
-        }
-        len--;
-        parse_point++;
+            break;
+
+        default:
+            break;
     }
 }
 
 /*-----------------------------------------------------------------------*/
 void fics_init() {
+    // Don't carry a partial line or telnet command over from an earlier connection
+    global.fics.line_length = 0;
+    global.fics.telnet_state = TS_DATA;
     plat_net_connect(global.ui.server_name, global.ui.server_port);
     if (ui_pregame_menu_options_menu.menu_items[UI_LOGIN_OPTIONS_REGISTERED].selected == 1 &&
             !global.ui.user_password[0]) {
@@ -713,7 +958,6 @@ void fics_play(bool use_seek) {
     } else {
         // Init the search cache
         memset(&fics_data, 0, sizeof(fics_data));
-        fics_data.rating_delta = -1;
         fics_set_new_data_callback(fics_ndcb_sought_list);
         plat_net_send(FICS_CMD_SOUGHT);
     }
@@ -725,9 +969,29 @@ void fics_set_new_data_callback(fics_new_data_callback_t callback) {
 }
 
 /*-----------------------------------------------------------------------*/
+// text must be at least 1 and at most FICS_TRIGGER_MAX characters long
 void fics_set_trigger_callback(const char *text, fics_match_callback_t callback) {
+    uint8_t i, k;
+
     global.fics.trigger_text = text;
     global.fics.match_callback = callback;
+    global.fics.trigger_state = 0;
+    if (text) {
+        // trigger_fail[i] is the length of the longest proper prefix of
+        // text that is also a suffix of text[0..i]
+        global.fics.trigger_fail[0] = 0;
+        k = 0;
+        for (i = 1; text[i]; i++) {
+            while (k && text[i] != text[k]) {
+                k = global.fics.trigger_fail[k - 1];
+            }
+            if (text[i] == text[k]) {
+                k++;
+            }
+            global.fics.trigger_fail[i] = k;
+        }
+        global.fics.trigger_length = i;
+    }
 }
 
 /*-----------------------------------------------------------------------*/
@@ -737,20 +1001,89 @@ void fics_shutdown() {
     plat_net_send(FICS_CMD_QUIT);
 }
 
+/*-----------------------------------------------------------------------*/
+// Remove telnet commands, bells and other control characters from buf, in
+// place, leaving only printable ASCII, '\n' and '\r'.  Tabs become spaces.
+// Option negotiations are not answered; FICS works without replies.
+// Returns the new length
+int fics_telnet_filter(unsigned char *buf, int len) {
+    unsigned char *src = buf;
+    unsigned char *dest = buf;
+    uint8_t state = global.fics.telnet_state;
+    unsigned char c;
+
+    while (len-- > 0) {
+        c = *src++;
+        switch (state) {
+            case TS_DATA:
+                if ((c >= 0x20 && c < 0x7F) || c == '\x0a' || c == '\x0d') {
+                    *dest++ = c;
+                } else if (c == '\x09') {
+                    *dest++ = '\x20';
+                } else if (c == TELNET_IAC) {
+                    state = TS_IAC;
+                }
+                break;
+
+            case TS_IAC:
+                if (c == TELNET_SB) {
+                    state = TS_SUB;
+                } else if (c >= TELNET_WILL && c <= TELNET_DONT) {
+                    state = TS_OPTION;
+                } else {
+                    // IAC IAC (a 0xFF data byte) or a 2 byte command
+                    state = TS_DATA;
+                }
+                break;
+
+            case TS_OPTION:
+                state = TS_DATA;
+                break;
+
+            case TS_SUB:
+                if (c == TELNET_IAC) {
+                    state = TS_SUB_IAC;
+                }
+                break;
+
+            case TS_SUB_IAC:
+                state = c == TELNET_SE ? TS_DATA : TS_SUB;
+                break;
+        }
+    }
+    global.fics.telnet_state = state;
+    return dest - buf;
+}
+
 /*-----------------------------------------------------------------------*/
 void fics_tcp_recv(const unsigned char *buf, int len) {
     if (len == -1) {
         app_error(false, "TCP recv error.");
         app_set_state(APP_STATE_OFFLINE);
     } else {
+        const char *data = (const char *)buf;
         const char *match;
-        log_add_line(&global.view.terminal, (const char *)buf, len);
-        if (global.fics.match_callback) {
-            if ((match = fics_strnstr((const char *)buf, len, global.fics.trigger_text))) {
-                (*global.fics.match_callback)((const char *)buf, len, match);
+        int used;
+        if (global.view.terminal_active) {
+            log_add_line(&global.view.terminal, data, len);
+        } else {
+            // Only formatted when the terminal is shown
+            log_capture(&global.view.terminal, data, len);
+        }
+        while (len > 0) {
+            if (global.fics.match_callback) {
+                if (!(match = fics_trigger_match(data, len))) {
+                    break;
+                }
+                (*global.fics.match_callback)(data, len, match);
+                // What follows the trigger goes to whatever the callback installed
+                len -= match - data;
+                data = match;
+            } else {
+                used = fics_line_feed(data, len);
+                data += used;
+                len -= used;
             }
-        } else if (global.fics.new_data_callback) {
-            (*global.fics.new_data_callback)((const char *)buf, len);
         }
     }
 }
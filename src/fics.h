@@ -10,6 +10,12 @@
 #ifndef _FICS_H_
 #define _FICS_H_
 
+// Longest server line that is reassembled when split over network reads
+#define FICS_LINE_MAX   256
+// Longest text that can be passed to fics_set_trigger_callback
+#define FICS_TRIGGER_MAX 32
+
+// match points just past the trigger text in buf
 typedef void(*fics_match_callback_t)(const char *buf, int len, const char *match);
 typedef void(*fics_new_data_callback_t)(const char *buf, int len);
 
@@ -19,6 +25,7 @@ void fics_play(bool use_seek);
 void fics_set_new_data_callback(fics_new_data_callback_t callback);
 void fics_set_trigger_callback(const char *text, fics_match_callback_t callback);
 void fics_shutdown(void);
+int fics_telnet_filter(unsigned char *buf, int len);
 void fics_tcp_recv(const unsigned char *buf, int len);
 
 enum {
@@ -35,6 +42,14 @@ enum {
     SOUGHT_COUNT,                   // 10 - Number of words - all words before this
 };
 
+// How many of the best sought games are kept to try, in order
+#define FICS_SOUGHT_CANDIDATES  4
+
+typedef struct _fics_candidate {
+    uint16_t rating_delta;                      // How far the seeker's rating is from mine
+    char game_number_str[6];                    // The sought game's game number
+} fics_candidate_t;
+
 typedef struct _fics_data {
     char status;                                // okay, error, need more data
     char parse_state;                           // what to look for in incoming sought data
@@ -42,8 +57,9 @@ typedef struct _fics_data {
     int length;                                 // length left beyond parse_point to search
     const char *sought_word[SOUGHT_COUNT];      // the words found in the current "line" - start ptr
     int sought_word_len[SOUGHT_COUNT];          // character count of words in sought_words
-    char game_number_str[6];                    // The sought game to play's game number
-    uint16_t rating_delta;                      // Used to determine best opponent (closest rating match)
+    fics_candidate_t candidate[FICS_SOUGHT_CANDIDATES]; // Games that fit, closest rating match first
+    uint8_t num_candidates;                     // Entries used in candidate
+    uint8_t next_candidate;                     // Entry to "play" if the previous one is gone
 } fics_data_t;
 
 extern fics_data_t fics_data;
@@ -0,0 +1,227 @@
+/*
+ *  fujinet.c
+ *  RetroMate
+ *
+ *  By S. Wessels and O. Schmidt, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  plat_net_* over the fujinet-lib network_* calls, shared by the Apple II,
+ *  the Atari and the host's POSIX socket build.  See fujinet.h.
+ */
+
+#include <string.h>
+
+#include "../global.h"
+
+#include "fujinet-network.h"
+#include "fujinet.h"
+
+fuji_t fuji;
+
+#ifdef __ATARI__
+// Out of the way, in the LOW memory below the screen (atari.cfg)
+#pragma bss-name( push, "FUJI_BSS")
+#endif
+unsigned char rxbuf[FUJI_RXBUF_SIZE];
+#ifdef __ATARI__
+#pragma bss-name( pop )
+#endif
+
+char* fn_strerror( uint8_t e ) {
+    switch (e)
+    {
+        case FN_ERR_OK:
+            return "OK";
+        case FN_ERR_IO_ERROR:
+            return "IO Error";
+        case FN_ERR_BAD_CMD:
+            return "bad cmd";
+        case FN_ERR_OFFLINE:
+           return "offline";
+        case FN_ERR_WARNING:
+           return "Warning issued";
+        case FN_ERR_NO_DEVICE:
+           return "no device";
+        default:
+            return "Unknown";
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Send the commands plat_net_send queued up, in the order they were queued
+static void fuji_flush() {
+#ifdef __ATARI__
+    const char *text, *end;
+    int len;
+#endif
+
+    if( !fuji.send_used ) {
+        return;
+    }
+#ifdef __ATARI__
+    // Each command, then its \x0a in a write of its own.  Sending the newline
+    // separately keeps the Atari's connection stable
+    end = fuji.send_buffer + fuji.send_used;
+    for( text = fuji.send_buffer; text < end; text += len + 1 ) {
+        len = strlen( text );
+        if( len ) {
+            network_write( fuji.devicespec, (unsigned char *)text, len );
+        }
+        network_write( fuji.devicespec, (unsigned char *)"\x0a", 1 );
+    }
+#else
+    network_write( fuji.devicespec, (unsigned char *)fuji.send_buffer, fuji.send_used );
+#endif
+    fuji.send_used = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// While data comes in, read it all (up to FUJI_DRAIN_READS buffers) in one
+// go.  While nothing comes in, and the platform can't tell, ask twice as
+// seldom each time, up to every FUJI_POLL_MAX passes.  plat_net_send goes
+// back to asking every pass
+static bool fuji_receive() {
+    uint8_t reads;
+    int16_t bytes_read;
+
+    if( !fuji.more ) {
+        switch( plat_fuji_poll() ) {
+            case FUJI_POLL_NO:
+                return 0;
+            case FUJI_POLL_MAYBE:
+                if( fuji.poll_countdown ) {
+                    fuji.poll_countdown--;
+                    return 0;
+                }
+                break;
+        }
+    }
+    fuji.more = false;
+
+    // network status gets bytes_waiting from DVSTAT, conn_status from DVSTAT+2
+    // and actual error code from DVSTAT+3 ( atari/src/fn_network/network_status.s)
+    // https://github.com/FujiNetWIFI/fujinet-firmware/wiki/N%3A-SIO-Command-%27S%27---Status
+    if( network_status( fuji.devicespec, &fuji.bytes_waiting, &fuji.conn_status, &fuji.err ) != FN_ERR_OK ||
+        !fuji.conn_status ) {
+        // network_status returns either FN_ERR_OK or FN_ERR_IO_ERROR
+        return 1;
+    }
+
+    if( !fuji.bytes_waiting ) {
+        fuji.poll_interval = fuji.poll_interval ? MIN( fuji.poll_interval * 2, FUJI_POLL_MAX ) : 1;
+        fuji.poll_countdown = fuji.poll_interval;
+        return 0;
+    }
+
+    fuji.poll_interval = 0;
+    for( reads = FUJI_DRAIN_READS; fuji.bytes_waiting && reads; reads-- ) {
+        bytes_read = network_read( fuji.devicespec, rxbuf, fuji.bytes_waiting < sizeof( rxbuf ) ? fuji.bytes_waiting : sizeof( rxbuf ) );
+        if( bytes_read <= 0 ) {
+            return bytes_read < 0;
+        }
+        fuji.bytes_waiting -= bytes_read;
+        // Strip telnet commands and control characters in place
+        bytes_read = fics_telnet_filter( rxbuf, bytes_read );
+        if( bytes_read > 0 ) {
+            // If this closes the connection, bytes_waiting is now 0
+            fics_tcp_recv( rxbuf, bytes_read );
+        }
+    }
+    // Over the budget, so come back for the rest next pass
+    fuji.more = fuji.bytes_waiting != 0;
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_init() {
+    uint8_t res = network_init();
+
+    plat_fuji_init();
+    if ( res ) { // returns status/error FN_ERR_* values  FN_ERR_OK ==0x00, so non zero is error
+        log_add_line(&global.view.terminal, "Init Network", -1);
+        plat_draw_log(&global.view.terminal, 0, 0, false);
+        app_error(true, fn_strerror(res));
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_connect(const char *server_name, int server_port) {
+    char digits[6];
+    char *d = digits + sizeof(digits) - 1;
+    unsigned port = server_port;
+    uint8_t res;
+
+    // "N:TELNET://server:port".  sprintf() adds ~1.5K to size, and the host
+    // has no itoa, so the port is done by hand
+    *d = '\0';
+    do {
+        *--d = '0' + port % 10;
+        port /= 10;
+    } while( port );
+    strcpy( fuji.devicespec, "N:TELNET://");
+    strcat( fuji.devicespec, server_name );
+    strcat( fuji.devicespec, ":" );
+    strcat( fuji.devicespec, d );
+
+    log_add_line(&global.view.terminal, "Connect to server", -1);
+    plat_draw_log(&global.view.terminal, 0, 0, false);
+
+    res = network_open( fuji.devicespec, OPEN_MODE_RW, OPEN_TRANS_NONE );
+    if( res ) {
+        app_error(true, fn_strerror(res));
+    }
+    log_add_line(&global.view.terminal, "Logging in", -1);
+    plat_draw_log(&global.view.terminal, 0, 0, false);
+
+    // Look straight away, in case something came in before the platform
+    // was set up to notice
+    fuji.poll_interval = fuji.poll_countdown = 0;
+    fuji.more = true;
+    plat_fuji_connected();
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_disconnect() {
+    fuji_flush();
+    plat_fuji_disconnect();
+    network_close( fuji.devicespec );
+    // This may be called from fics_tcp_recv, so stop fuji_receive reading on
+    fuji.bytes_waiting = 0;
+    fuji.more = false;
+}
+
+/*-----------------------------------------------------------------------*/
+// Send what was queued since the last pass, then anything the replies to
+// what came in queued
+bool plat_net_update() {
+    bool result;
+
+    fuji_flush();
+    result = fuji_receive();
+    fuji_flush();
+    return result;
+}
+
+/*-----------------------------------------------------------------------*/
+// Queued for plat_net_update, which sends it with the newline in one
+// network_write, along with anything else queued before it (the Atari
+// writes each newline on its own, see fuji_flush)
+void plat_net_send(const char *text) {
+    int len = strlen(text);
+
+    log_add_line(&global.view.terminal, text, len);
+    if( fuji.send_used + len + 1 > FUJI_SEND_SIZE ) {
+        fuji_flush();
+    }
+    plat_fuji_ascii( fuji.send_buffer + fuji.send_used, text, len );
+    fuji.send_used += len;
+    // An ASCII newline, which isn't '\n' on the Atari, or where one goes
+    fuji.send_buffer[fuji.send_used++] = FUJI_SEND_END;
+    // The reply should be on its way, so look for it straight away
+    fuji.poll_interval = fuji.poll_countdown = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_shutdown() {
+    plat_net_disconnect();
+}
@@ -0,0 +1,64 @@
+/*
+ *  fujinet.h
+ *  RetroMate
+ *
+ *  By S. Wessels and O. Schmidt, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  plat_net_* for the platforms that talk to the server through a FujiNet
+ *  N: device.  fujinet.c does the work; each platform only supplies the
+ *  plat_fuji_* hooks below, in its platXXnet.c.
+ */
+
+#ifndef _FUJINET_H_
+#define _FUJINET_H_
+
+// Most network_reads one plat_net_update does while data is waiting
+#define FUJI_DRAIN_READS    4
+// Most main loop passes between status calls on an idle connection, when
+// the platform can't tell if data came in (FUJI_POLL_MAYBE)
+#define FUJI_POLL_MAX       32
+// Commands plat_net_send queues up, sent with one network_write per pass
+#define FUJI_SEND_SIZE      256
+// Ends each command in send_buffer.  The Atari sends the newline with a
+// network_write of its own, so there a 0 marks the end of each command
+#ifdef __ATARI__
+#define FUJI_SEND_END       0x00
+#else
+#define FUJI_SEND_END       0x0a
+#endif
+// ip_65 eth_buffer.s .res 1518 &  drivers/ethernetcombo.s drivers/ethernet.s stax #1518
+#define FUJI_RXBUF_SIZE     1518
+
+// What plat_fuji_poll knows about data waiting in the FujiNet
+enum {
+    FUJI_POLL_NO,                   // Nothing came in, so don't ask
+    FUJI_POLL_YES,                  // Something came in
+    FUJI_POLL_MAYBE,                // Can't tell - ask, but less often while idle
+};
+
+typedef struct _fuji {
+    char devicespec[64];
+    uint16_t bytes_waiting;
+    uint8_t conn_status;
+    uint8_t err;
+    uint8_t poll_interval;          // Passes to skip after the next status finds nothing
+    uint8_t poll_countdown;         // Passes left to skip before the next status
+    bool more;                      // Data was left after FUJI_DRAIN_READS
+    int send_used;
+    char send_buffer[FUJI_SEND_SIZE];
+} fuji_t;
+
+extern fuji_t fuji;
+
+char *fn_strerror(uint8_t e);
+
+// The platform hooks
+void plat_fuji_init(void);          // After network_init
+void plat_fuji_connected(void);     // After network_open
+void plat_fuji_disconnect(void);    // Before network_close
+uint8_t plat_fuji_poll(void);       // One of FUJI_POLL_*
+// Copy len characters of text to dest, as ASCII
+void plat_fuji_ascii(char *dest, const char *text, int len);
+
+#endif //_FUJINET_H_
@@ -45,6 +45,9 @@ global_t global = {
             0,                                      // working y
         },
         true,                                       // refresh
+        false,                                      // board_changed
+        0,                                          // flip
+        CLEAR_ROW_NONE,                             // statslog_clear_row
         {0, ' ', 0, ' '},                           // cursor_char[4]
         "",                                         // scratch_buffer
         "say "                                      // say_buffer
@@ -84,15 +87,18 @@ global_t global = {
         // state
         {
             // chess_board
-            "\x72\x6e\x62\x71\x6b\x62\x6e\x72"      // "rnbqkbnr"
-            "\x70\x70\x70\x70\x70\x70\x70\x70"      // "pppppppp"
-            "\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d"      // "--------"
-            "\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d"      // "--------"
-            "\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d"      // "--------"
-            "\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d"      // "--------"
-            "\x50\x50\x50\x50\x50\x50\x50\x50"      // "PPPPPPPP"
-            "\x52\x4e\x42\x51\x4b\x42\x4e\x52"      // "RNBQKBNR"
+            ROOK, KNIGHT, BISHOP, QUEEN, KING, BISHOP, KNIGHT, ROOK,
+            PAWN, PAWN, PAWN, PAWN, PAWN, PAWN, PAWN, PAWN,
+            NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE,
+            NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE,
+            NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE,
+            NONE, NONE, NONE, NONE, NONE, NONE, NONE, NONE,
+            PAWN | PIECE_WHITE, PAWN | PIECE_WHITE, PAWN | PIECE_WHITE, PAWN | PIECE_WHITE,
+            PAWN | PIECE_WHITE, PAWN | PIECE_WHITE, PAWN | PIECE_WHITE, PAWN | PIECE_WHITE,
+            ROOK | PIECE_WHITE, KNIGHT | PIECE_WHITE, BISHOP | PIECE_WHITE, QUEEN | PIECE_WHITE,
+            KING | PIECE_WHITE, BISHOP | PIECE_WHITE, KNIGHT | PIECE_WHITE, ROOK | PIECE_WHITE,
         },
+        {0},                                        // drawn_board
         "a1-a1",                                    // move_str[6]
         false,                                      // game_active
         false,                                      // includes_me
@@ -100,37 +106,40 @@ global_t global = {
         false,                                      // my_side
         0,                                          // server_state
         0,                                          // cursor
-        -1,                                         // prev_cursor
+        {MARKER_NONE, MARKER_NONE},                 // markers[2]
         0,                                          // selector_index
         {0, 0},                                     // selector[2]
     },
     {
         // fics
         NULL,                                       // trigger_text
+        0,                                          // trigger_length
+        0,                                          // trigger_state
+        {0},                                        // trigger_fail
         NULL,                                       // match_callback
         NULL,                                       // new_data_callback
+        0,                                          // telnet_state
+        0,                                          // line_length
+        "",                                         // line_buffer
     },
     {
         // frame
-        "",                                         //color_to_move
-        "",                                         //double_pawn_push
-        "",                                         //w_can_castle_l
-        "",                                         //w_can_castle_s
-        "",                                         //b_can_castle_l
-        "",                                         //b_can_castle_s
-        "",                                         //moves_since_irreversible
-        "",                                         //game_number
-        "",                                         //w_name
-        "",                                         //b_name
-        "",                                         //my_relation_to_game
-        "",                                         //initial_time
-        "",                                         //time_increment
-        "",                                         //w_strength
-        "",                                         //b_strength
-        "",                                         //w_remaining_time
-        "",                                         //b_remaining_time
-        "",                                         //move_number
-        "",                                         //previous_move
+        {},                                         // board
+        0,                                          // flags
+        -1,                                         // double_pawn_push
+        0,                                          // moves_since_irreversible
+        0,                                          // my_relation_to_game
+        0,                                          // game_number
+        0,                                          // initial_time
+        0,                                          // time_increment
+        0,                                          // w_strength
+        0,                                          // b_strength
+        0,                                          // w_remaining_time
+        0,                                          // b_remaining_time
+        0,                                          // move_number
+        "",                                         // w_name
+        "",                                         // b_name
+        "",                                         // previous_move
     },
     {
         // text
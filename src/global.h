@@ -69,8 +69,18 @@ enum {
     PAWN,
 };
 
-#define HCOLOR_SELECTED             0
-#define HCOLOR_VALID                1
+// Board markers, shown by plat_draw_markers
+#define MARKER_CURSOR               0
+#define MARKER_SELECTED             1
+#define MARKER_NONE                 0xFF
+
+// Board positions are a8..h1 (0..63).  Square n on screen, counting from
+// the top left, shows position n ^ global.view.flip, so with BOARD_FLIPPED
+// black is at the bottom
+#define BOARD_FLIPPED               63
+
+// view.statslog_clear_row when there's no status area clear waiting
+#define CLEAR_ROW_NONE              0xFF
 
 #define SIDE_BLACK                  0
 #define SIDE_WHITE                  1
@@ -103,7 +113,10 @@ typedef struct _view {
     bool terminal_active;
     uint8_t pan_value;
     menu_cache_t mc;
-    bool refresh;
+    bool refresh;                   // Redraw the whole board
+    bool board_changed;             // Redraw squares that differ from drawn_board
+    uint8_t flip;                   // BOARD_FLIPPED when black is at the bottom, else 0
+    uint8_t statslog_clear_row;     // Clear the status area from here down, or CLEAR_ROW_NONE
     char cursor_char[4];
     char scratch_buffer[81];
     char say_buffer[51];
@@ -146,7 +159,8 @@ typedef struct _app {
 
 // State variables for differenrt phases of the game (application)
 typedef struct _state {
-    char chess_board[65];
+    uint8_t chess_board[64];
+    uint8_t drawn_board[64];        // What plat_draw_square last put on screen
     char move_str[6];
     bool game_active;
     bool includes_me;
@@ -154,7 +168,7 @@ typedef struct _state {
     bool my_side;
     uint8_t server_state;
     int8_t cursor;
-    int8_t prev_cursor;
+    uint8_t markers[2];             // Where plat_draw_markers last put each marker
     uint8_t selector_index;
     uint8_t selector[2];
 } state_t;
@@ -162,31 +176,41 @@ typedef struct _state {
 // Specific to the telnet parsing
 typedef struct _fics {
     const char *trigger_text;
+    uint8_t trigger_length;
+    uint8_t trigger_state;                      // characters of trigger_text matched so far
+    uint8_t trigger_fail[FICS_TRIGGER_MAX];     // KMP failure table for trigger_text
     fics_match_callback_t match_callback;
     fics_new_data_callback_t new_data_callback;
+    uint8_t telnet_state;                       // where fics_telnet_filter is in a telnet command
+    int line_length;                            // bytes of a partial line held in line_buffer
+    char line_buffer[FICS_LINE_MAX];            // carries a line split across network reads
 } fics_t;
 
-// Where a frame coming from the fics server is unpacked
+// Bits in frame_t.flags
+#define FRAME_WHITE_TO_MOVE         0x01
+#define FRAME_W_CAN_CASTLE_L        0x02
+#define FRAME_W_CAN_CASTLE_S        0x04
+#define FRAME_B_CAN_CASTLE_L        0x08
+#define FRAME_B_CAN_CASTLE_S        0x10
+
+// Where a style 12 frame coming from the fics server is decoded
 typedef struct _frame {
-    char color_to_move[1 + 1];
-    char double_pawn_push[2 + 1];
-    char w_can_castle_l[1 + 1];
-    char w_can_castle_s[1 + 1];
-    char b_can_castle_l[1 + 1];
-    char b_can_castle_s[1 + 1];
-    char moves_since_irreversible[3 + 1];
-    char game_number[6 + 1];
+    uint8_t board[64];                          // Piece codes (see fics_letter_to_piece), a8..h1
+    uint8_t flags;                              // FRAME_* bits
+    int8_t double_pawn_push;                    // File of a double pawn push, or -1
+    uint8_t moves_since_irreversible;
+    int8_t my_relation_to_game;                 // 1 my move, -1 opponent's move, 0 observing, etc.
+    int game_number;
+    int initial_time;                           // Minutes
+    int time_increment;                         // Seconds
+    int w_strength;
+    int b_strength;
+    int w_remaining_time;                       // Seconds, negative once the flag fell
+    int b_remaining_time;
+    int move_number;
     char w_name[18 + 1];
     char b_name[18 + 1];
-    char my_relation_to_game[2 + 1];
-    char initial_time[3 + 1];
-    char time_increment[3 + 1];
-    char w_strength[3 + 1];
-    char b_strength[3 + 1];
-    char w_remaining_time[3 + 1];
-    char b_remaining_time[3 + 1];
-    char move_number[3 + 1];
-    char previous_move[7 + 1];
+    char previous_move[9 + 1];                  // Long enough for P/e7-e8=Q
 } frame_t;
 
 typedef struct _text {
@@ -0,0 +1,81 @@
+/*
+ *  platHost.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _PLATHOST_H_
+#define _PLATHOST_H_
+
+#include <stdio.h>
+
+/*-----------------------------------------------------------------------*/
+// These are text based coordinates, same as the Apple II
+#define SCREEN_TEXT_WIDTH       40
+#define SCREEN_TEXT_HEIGHT      24
+#define SQUARE_TEXT_WIDTH       3
+
+// Default bytes handed to fics_tcp_recv per plat_net_update, for raw files
+#define HOST_CHUNK_SIZE         128
+// Largest network read, the size of rxbuf on the FujiNet platforms
+#define HOST_RXBUF_SIZE         1518
+// Largest record in a transcript (util/proxy.py reads 4096 at a time)
+#define HOST_RECORD_SIZE        4096
+
+// How RETROMATE_CHUNK splits the data up into reads
+enum {
+    HOST_CHUNK_FIXED,               // A number: reads of at most that many bytes
+    HOST_CHUNK_RANDOM,              // "random": 1..HOST_RXBUF_SIZE bytes
+    HOST_CHUNK_RECORD,              // "record": as recorded, up to HOST_RXBUF_SIZE
+};
+
+// How often the core called into the platform
+typedef struct _host_stats {
+    unsigned long loops;
+    unsigned long draw_board;
+    unsigned long draw_square;
+    unsigned long draw_markers;
+    unsigned long draw_log;
+    unsigned long draw_log_rows;
+    unsigned long draw_log_chars;
+    unsigned long draw_text;
+    unsigned long draw_rect;
+    unsigned long clear_statslog;
+    unsigned long net_reads;
+    unsigned long net_bytes;
+    unsigned long net_sends;
+    unsigned long boards;
+    double parse_seconds;           // Time spent in fics_telnet_filter and fics_tcp_recv
+    double first_board_seconds;     // From connecting to the first style 12 board
+} host_stats_t;
+
+typedef struct _host {
+    FILE *replay;                   // Server data is read from here
+    bool transcript;                // replay is a util/proxy.py transcript, not raw data
+    bool paced;                     // Deliver transcript records at their recorded times
+    uint8_t chunk_mode;
+    int chunk_size;                 // Most bytes per network read (HOST_CHUNK_FIXED)
+    unsigned long seed;             // For HOST_CHUNK_RANDOM
+    double start_time;
+    double record_time;             // When the record in pending was received
+    int pending_length;
+    int pending_used;
+    const char *keys;               // Scripted key presses, one per main loop
+    int net_socket;                 // The server connection (host-net build)
+    host_stats_t stats;
+    unsigned char pending[HOST_RECORD_SIZE];
+    unsigned char rxbuf[HOST_RXBUF_SIZE];
+    char terminal_log_buffer[80 * 23];
+    char status_log_buffer[13 * 24];
+} host_t;
+
+extern host_t host;
+
+void host_frame_decoded(void);
+double host_now(void);
+void host_print_stats(void);
+
+#endif //_PLATHOST_H_
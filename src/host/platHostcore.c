@@ -0,0 +1,223 @@
+/*
+ *  platHostcore.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  A stand-in platform so the portable core (app, fics, log, menu, ui...)
+ *  can be built and run natively, under a profiler or sanitizers.
+ *  Nothing is shown; draw calls and network sends are counted, and server
+ *  data is played back from a file.  Controlled with environment variables:
+ *    RETROMATE_REPLAY  raw server data or a util/proxy.py transcript
+ *                      (default stdin)
+ *    RETROMATE_CHUNK   how to split the data into network reads: a number
+ *                      of bytes, "random" or "record" (transcripts only).
+ *                      The default is "record" for transcripts, else
+ *                      HOST_CHUNK_SIZE
+ *    RETROMATE_SEED    seed for "random" (default 1)
+ *    RETROMATE_PACE    "real" to deliver transcript records at the time they
+ *                      were recorded (default as fast as possible)
+ *    RETROMATE_KEYS    key presses, one per main loop (default "\r" which
+ *                      selects Play in the main menu)
+ *    RETROMATE_SERVER  host-net build only: "host:port" to connect to instead
+ *                      of the server set in the app (src/host/posix)
+ *  Every board decoded from a style 12 line is printed, as is everything
+ *  sent, so the output of runs with different chunking can be compared.
+ *  Counts and timings go to stderr.
+ */
+
+#include <stdlib.h> // exit, getenv, atoi, strtoul
+#include <string.h> // memcpy, strcmp
+#include <time.h>   // clock_gettime
+
+#include "../global.h"
+
+#include "platHost.h"
+
+host_t host;
+
+/*-----------------------------------------------------------------------*/
+// Called by fics.c each time a style 12 line has been decoded
+void host_frame_decoded() {
+    static const char letters[] = "-rnbqkp";
+    char board[64 + 1];
+    uint8_t i, piece;
+
+    for (i = 0; i < 64; i++) {
+        piece = global.frame.board[i];
+        board[i] = letters[(piece & ~PIECE_WHITE) % (sizeof(letters) - 1)];
+        if (piece & PIECE_WHITE) {
+            board[i] -= 'a' - 'A';
+        }
+    }
+    board[64] = '\0';
+    if (!host.stats.boards++) {
+        host.stats.first_board_seconds = host_now() - host.start_time;
+    }
+    printf("board %d %d %c %s %s\n", global.frame.game_number, global.frame.move_number,
+           global.frame.flags & FRAME_WHITE_TO_MOVE ? 'W' : 'B', global.frame.previous_move, board);
+}
+
+/*-----------------------------------------------------------------------*/
+double host_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*-----------------------------------------------------------------------*/
+void host_print_stats() {
+    fprintf(stderr, "loops %lu\n", host.stats.loops);
+    fprintf(stderr, "draw_board %lu\n", host.stats.draw_board);
+    fprintf(stderr, "draw_square %lu\n", host.stats.draw_square);
+    fprintf(stderr, "draw_markers %lu\n", host.stats.draw_markers);
+    fprintf(stderr, "draw_log %lu (%lu rows, %lu chars)\n", host.stats.draw_log, host.stats.draw_log_rows,
+            host.stats.draw_log_chars);
+    fprintf(stderr, "draw_text %lu\n", host.stats.draw_text);
+    fprintf(stderr, "draw_rect %lu\n", host.stats.draw_rect);
+    fprintf(stderr, "clear_statslog %lu\n", host.stats.clear_statslog);
+    fprintf(stderr, "net_reads %lu (%lu bytes)\n", host.stats.net_reads, host.stats.net_bytes);
+    fprintf(stderr, "net_sends %lu\n", host.stats.net_sends);
+    fprintf(stderr, "boards %lu\n", host.stats.boards);
+    if (host.start_time > 0) {
+        fprintf(stderr, "connected %.6f s, first board after %.6f s\n", host_now() - host.start_time,
+                host.stats.first_board_seconds);
+    }
+    if (host.stats.parse_seconds > 0) {
+        fprintf(stderr, "parse %.6f s, %.0f bytes/s, %.0f reads/s\n", host.stats.parse_seconds,
+                host.stats.net_bytes / host.stats.parse_seconds, host.stats.net_reads / host.stats.parse_seconds);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_active_term(bool active) {
+    global.view.terminal_active = active;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
+    memcpy(dest, src, n);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_exit() {
+    host_print_stats();
+    exit(1);
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_cols(void) {
+    if (global.view.terminal_active) {
+        return 80;
+    }
+    return SCREEN_TEXT_WIDTH;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_rows(void) {
+    return SCREEN_TEXT_HEIGHT;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_status_x(void) {
+    return 3 + SQUARE_TEXT_WIDTH * 8;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_init() {
+    const char *value;
+
+    // plat_net_connect picks "record" for transcripts if this is left alone
+    host.chunk_mode = HOST_CHUNK_RECORD;
+    host.chunk_size = HOST_CHUNK_SIZE;
+    if ((value = getenv("RETROMATE_CHUNK"))) {
+        if (!strcmp(value, "random")) {
+            host.chunk_mode = HOST_CHUNK_RANDOM;
+        } else if (strcmp(value, "record")) {
+            host.chunk_mode = HOST_CHUNK_FIXED;
+            host.chunk_size = atoi(value);
+            if (host.chunk_size < 1 || host.chunk_size > HOST_RXBUF_SIZE) {
+                host.chunk_size = HOST_CHUNK_SIZE;
+            }
+        }
+    }
+    host.seed = 1;
+    if ((value = getenv("RETROMATE_SEED"))) {
+        host.seed = strtoul(value, NULL, 10);
+    }
+    host.paced = (value = getenv("RETROMATE_PACE")) && !strcmp(value, "real");
+    host.keys = getenv("RETROMATE_KEYS");
+    if (!host.keys) {
+        host.keys = "\r";
+    }
+    plat_draw_splash_screen();
+    plat_draw_board();
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_key_input(input_event_t *evt) {
+    uint8_t k;
+
+    host.stats.loops++;
+    evt->code = INPUT_NONE;
+
+    if (!*host.keys) {
+        return 0;
+    }
+
+    k = *host.keys++;
+    evt->key_value = k;
+    switch (k) {
+        case 27:  // esc
+            evt->code = INPUT_BACK;
+            break;
+        case 13:  // return
+            evt->code = INPUT_SELECT;
+            break;
+        case 9:   // tab
+            evt->code = INPUT_VIEW_TOGGLE;
+            break;
+        case 127: // DEL
+            evt->code = INPUT_BACKSPACE;
+            break;
+        case 17:  // CTRL+Q
+            evt->code = INPUT_QUIT;
+            break;
+        default:  // any other key
+            evt->code = INPUT_KEY;
+    }
+    return 1;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_key_wait_any() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_log_free_mem(char *mem) {
+    UNUSED(mem);
+}
+
+/*-----------------------------------------------------------------------*/
+char *plat_core_log_malloc(unsigned int size) {
+    if (size == (80 * 23)) {
+        return host.terminal_log_buffer;
+    }
+    return host.status_log_buffer;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_mouse_to_cursor(void) {
+    return MOUSE_HIT_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_mouse_to_menu_item(void) {
+    return MOUSE_HIT_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_shutdown() {
+    host_print_stats();
+}
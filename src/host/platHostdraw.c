@@ -0,0 +1,149 @@
+/*
+ *  platHostdraw.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  Draw calls only update the state the core relies on, and are counted.
+ */
+
+#include <string.h> // memset
+
+#include "../global.h"
+
+#include "platHost.h"
+
+uint8_t plat_mc2pc[9] = {
+    0,  // MENU_COLOR_BACKGROUND
+    1,  // MENU_COLOR_FRAME
+    0,  // MENU_COLOR_TITLE
+    0,  // MENU_COLOR_ITEM
+    0,  // MENU_COLOR_CYCLE
+    0,  // MENU_COLOR_CALLBACK
+    0,  // MENU_COLOR_SUBMENU
+    0,  // MENU_COLOR_SELECTED
+    0,  // MENU_COLOR_DISABLED
+};
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
+    UNUSED(m);
+    UNUSED(data);
+    plat_draw_clrscr();
+    plat_draw_board();
+    return MENU_DRAW_REDRAW;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_background() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_board_accoutrements() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_board() {
+    uint8_t i;
+    host.stats.draw_board++;
+    plat_draw_board_accoutrements();
+    for (i = 0; i < 64; ++i) {
+        plat_draw_square(i);
+    }
+    global.view.refresh = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clear_input_line(bool active) {
+    UNUSED(active);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clear_statslog_area(uint8_t row) {
+    UNUSED(row);
+    host.stats.clear_statslog++;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clrscr() {
+}
+
+/*-----------------------------------------------------------------------*/
+// Same row selection as the 8-bit platforms (without panning), counted
+void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool use_color) {
+    uint8_t i, len;
+    uint8_t row = log->size >= log->rows ? log->head : 0;
+
+    UNUSED(use_color);
+    host.stats.draw_log++;
+    log->modified = false;
+
+    for (i = 0; i < log->size; ++i, ++y) {
+        if (log->dirty[i]) {
+            len = log->used[row];
+            plat_draw_text(x, y, log->buffer + row * log->cols, MIN(MAX(len, log->shown[i]), log->cols));
+            host.stats.draw_log_rows++;
+            host.stats.draw_log_chars += MIN(MAX(len, log->shown[i]), log->cols);
+            log->shown[i] = len;
+        }
+        if (++row >= log->rows) {
+            row = 0;
+        }
+    }
+    memset(log->dirty, 0, sizeof(log->dirty));
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_markers(uint8_t cursor, uint8_t selected) {
+    global.state.markers[MARKER_CURSOR] = cursor;
+    global.state.markers[MARKER_SELECTED] = selected;
+    host.stats.draw_markers++;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(w);
+    UNUSED(h);
+    UNUSED(color);
+    host.stats.draw_rect++;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_save_under() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_set_color(uint8_t color) {
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_set_text_bg_color(uint8_t color) {
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_splash_screen() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_square(uint8_t position) {
+    global.state.drawn_board[position] = global.state.chess_board[position];
+    host.stats.draw_square++;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(text);
+    UNUSED(len);
+    host.stats.draw_text++;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_update() {
+}
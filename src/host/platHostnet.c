@@ -0,0 +1,160 @@
+/*
+ *  platHostnet.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  Plays server data back from RETROMATE_REPLAY (or stdin), split up into
+ *  reads as set by RETROMATE_CHUNK.  What the client sends is printed.  The
+ *  app quits once all the data has been played back.
+ */
+
+#include <stdlib.h> // getenv
+#include <string.h>
+#include <time.h>   // nanosleep
+
+#include "../global.h"
+
+#include "platHost.h"
+
+// First line of a util/proxy.py transcript
+#define HOST_TRANSCRIPT_HEADER  "# RetroMate transcript\n"
+
+/*-----------------------------------------------------------------------*/
+// Load the next block of server data into pending.  Returns false at the end
+static bool host_next_record() {
+    double time;
+    char direction;
+    int length;
+
+    host.pending_used = 0;
+    host.pending_length = 0;
+    if (!host.transcript) {
+        host.pending_length = fread(host.pending, 1, host.chunk_mode == HOST_CHUNK_RECORD ? HOST_CHUNK_SIZE : HOST_RECORD_SIZE, host.replay);
+        return host.pending_length > 0;
+    }
+    // "<seconds> <S or C> <length>\n<length bytes>\n"
+    while (fscanf(host.replay, "%lf %c %d", &time, &direction, &length) == 3) {
+        if (fgetc(host.replay) != '\n' || length < 0 || length > HOST_RECORD_SIZE ||
+                (int)fread(host.pending, 1, length, host.replay) != length) {
+            break;
+        }
+        if (direction == 'S') {
+            host.record_time = time;
+            host.pending_length = length;
+            return length > 0;
+        }
+    }
+    return false;
+}
+
+/*-----------------------------------------------------------------------*/
+// Next pseudo random read size - the same on every host for the same seed
+static int host_random_chunk() {
+    host.seed = (host.seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+    return 1 + (int)((host.seed >> 16) % HOST_RXBUF_SIZE);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_init() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_connect(const char *server_name, int server_port) {
+    const char *file_name = getenv("RETROMATE_REPLAY");
+    int length;
+
+    UNUSED(server_name);
+    UNUSED(server_port);
+
+    host.replay = file_name ? fopen(file_name, "rb") : stdin;
+    if (!host.replay) {
+        app_error(true, "Can't open RETROMATE_REPLAY");
+        return;
+    }
+
+    // Raw data goes straight through, so whatever was read to check for a
+    // header is the first data
+    length = fread(host.pending, 1, sizeof(HOST_TRANSCRIPT_HEADER) - 1, host.replay);
+    host.transcript = length == sizeof(HOST_TRANSCRIPT_HEADER) - 1 &&
+                      !memcmp(host.pending, HOST_TRANSCRIPT_HEADER, length);
+    host.pending_used = 0;
+    host.pending_length = host.transcript ? 0 : length;
+    host.start_time = host_now();
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_disconnect() {
+    if (host.replay && host.replay != stdin) {
+        fclose(host.replay);
+    }
+    host.replay = NULL;
+}
+
+/*-----------------------------------------------------------------------*/
+bool plat_net_update() {
+    int bytes_read;
+    double start, delay;
+    struct timespec ts;
+
+    if (!host.replay) {
+        return 0;
+    }
+    if (host.pending_used >= host.pending_length) {
+        if (!host_next_record()) {
+            // All played back
+            plat_net_disconnect();
+            global.app.quit = true;
+            return 0;
+        }
+        if (host.paced && host.transcript) {
+            // Wait for the time this record came in
+            delay = host.start_time + host.record_time - host_now();
+            if (delay > 0) {
+                ts.tv_sec = (time_t)delay;
+                ts.tv_nsec = (long)((delay - ts.tv_sec) * 1e9);
+                nanosleep(&ts, NULL);
+            }
+        }
+    }
+
+    switch (host.chunk_mode) {
+        case HOST_CHUNK_FIXED:
+            bytes_read = host.chunk_size;
+            break;
+        case HOST_CHUNK_RANDOM:
+            bytes_read = host_random_chunk();
+            break;
+        default:
+            bytes_read = HOST_RXBUF_SIZE;
+            break;
+    }
+    if (bytes_read > host.pending_length - host.pending_used) {
+        bytes_read = host.pending_length - host.pending_used;
+    }
+    memcpy(host.rxbuf, host.pending + host.pending_used, bytes_read);
+    host.pending_used += bytes_read;
+
+    host.stats.net_reads++;
+    host.stats.net_bytes += bytes_read;
+    start = host_now();
+    bytes_read = fics_telnet_filter(host.rxbuf, bytes_read);
+    if (bytes_read > 0) {
+        fics_tcp_recv(host.rxbuf, bytes_read);
+    }
+    host.stats.parse_seconds += host_now() - start;
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_send(const char *text) {
+    host.stats.net_sends++;
+    log_add_line(&global.view.terminal, text, -1);
+    printf("send: %s\n", text);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_shutdown() {
+    plat_net_disconnect();
+}
@@ -0,0 +1,40 @@
+/*
+ *  fujinet-network.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  The part of the fujinet-lib network API that src/fujinet uses, for the
+ *  host-net build (see the Makefile).  network.c implements it over a
+ *  POSIX TCP socket, so the FujiNet receive and send code can be run
+ *  against a local server.
+ */
+
+#ifndef _FUJINET_NETWORK_H_
+#define _FUJINET_NETWORK_H_
+
+#include <stdint.h>
+
+// Status/error codes, as in fujinet-lib
+#define FN_ERR_OK               0x00
+#define FN_ERR_IO_ERROR         0x01
+#define FN_ERR_BAD_CMD          0x02
+#define FN_ERR_OFFLINE          0x03
+#define FN_ERR_WARNING          0x04
+#define FN_ERR_NO_DEVICE        0x05
+#define FN_ERR_UNKNOWN          0xFF
+
+// network_open modes and translations.  Only a read/write connection with
+// no translation is supported
+#define OPEN_MODE_RW            0x0C
+#define OPEN_TRANS_NONE         0x00
+
+uint8_t network_init(void);
+uint8_t network_open(const char *devicespec, uint8_t mode, uint8_t trans);
+uint8_t network_close(const char *devicespec);
+uint8_t network_status(const char *devicespec, uint16_t *bw, uint8_t *c, uint8_t *err);
+int16_t network_read(const char *devicespec, uint8_t *buf, uint16_t len);
+uint8_t network_write(const char *devicespec, const uint8_t *buf, uint16_t len);
+
+#endif //_FUJINET_NETWORK_H_
@@ -0,0 +1,157 @@
+/*
+ *  network.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  The fujinet-lib network_* calls over a POSIX TCP socket, for the
+ *  host-net build.  There is one connection, to the host and port in an
+ *  "N:TELNET://host:port" devicespec, or to RETROMATE_SERVER ("host:port")
+ *  if that is set.  Reads and writes are counted in host.stats.
+ */
+
+#include <netdb.h>
+#include <signal.h>
+#include <stdlib.h>         // getenv
+#include <string.h>
+#include <unistd.h>         // close
+#include <netinet/in.h>
+#include <netinet/tcp.h>    // TCP_NODELAY
+#include <sys/ioctl.h>      // FIONREAD
+#include <sys/socket.h>
+
+#include "../../global.h"
+
+#include "../platHost.h"
+
+#include "fujinet-network.h"
+
+/*-----------------------------------------------------------------------*/
+uint8_t network_init() {
+    host.net_socket = -1;
+    // A server that hangs up should show as a disconnect, not kill the run
+    signal(SIGPIPE, SIG_IGN);
+    return FN_ERR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t network_open(const char *devicespec, uint8_t mode, uint8_t trans) {
+    char address[64];
+    const char *server = getenv("RETROMATE_SERVER");
+    char *port;
+    struct addrinfo hints, *info, *ai;
+    int one = 1;
+
+    if (mode != OPEN_MODE_RW || trans != OPEN_TRANS_NONE) {
+        return FN_ERR_BAD_CMD;
+    }
+    if (!server) {
+        // Past the "N:PROTOCOL://"
+        server = strstr(devicespec, "://");
+        if (!server) {
+            return FN_ERR_BAD_CMD;
+        }
+        server += 3;
+    }
+    strncpy(address, server, sizeof(address) - 1);
+    address[sizeof(address) - 1] = '\0';
+    address[strcspn(address, "/")] = '\0';
+    port = strrchr(address, ':');
+    if (!port) {
+        return FN_ERR_BAD_CMD;
+    }
+    *port++ = '\0';
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    if (getaddrinfo(address, port, &hints, &info)) {
+        return FN_ERR_IO_ERROR;
+    }
+    for (ai = info; ai; ai = ai->ai_next) {
+        host.net_socket = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (host.net_socket < 0) {
+            continue;
+        }
+        if (!connect(host.net_socket, ai->ai_addr, ai->ai_addrlen)) {
+            break;
+        }
+        close(host.net_socket);
+        host.net_socket = -1;
+    }
+    freeaddrinfo(info);
+    if (host.net_socket < 0) {
+        return FN_ERR_IO_ERROR;
+    }
+    // The client already puts a whole pass worth of commands in one write
+    setsockopt(host.net_socket, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    host.start_time = host_now();
+    return FN_ERR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t network_close(const char *devicespec) {
+    UNUSED(devicespec);
+    if (host.net_socket >= 0) {
+        close(host.net_socket);
+        host.net_socket = -1;
+    }
+    return FN_ERR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+// As the FujiNet reports it: still connected while there is data to read,
+// even if the server has hung up
+uint8_t network_status(const char *devicespec, uint16_t *bw, uint8_t *c, uint8_t *err) {
+    int waiting = 0;
+    char peek;
+
+    UNUSED(devicespec);
+    *bw = 0;
+    *c = 0;
+    *err = FN_ERR_OK;
+    if (host.net_socket < 0) {
+        return FN_ERR_OK;
+    }
+    if (ioctl(host.net_socket, FIONREAD, &waiting) < 0) {
+        return FN_ERR_IO_ERROR;
+    }
+    *bw = waiting > 0xFFFF ? 0xFFFF : waiting;
+    *c = waiting > 0 || recv(host.net_socket, &peek, 1, MSG_PEEK | MSG_DONTWAIT) != 0;
+    return FN_ERR_OK;
+}
+
+/*-----------------------------------------------------------------------*/
+int16_t network_read(const char *devicespec, uint8_t *buf, uint16_t len) {
+    ssize_t bytes_read;
+
+    UNUSED(devicespec);
+    if (len > 0x7FFF) {
+        len = 0x7FFF;
+    }
+    bytes_read = recv(host.net_socket, buf, len, 0);
+    if (bytes_read < 0) {
+        return -1;
+    }
+    host.stats.net_reads++;
+    host.stats.net_bytes += bytes_read;
+    return bytes_read;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t network_write(const char *devicespec, const uint8_t *buf, uint16_t len) {
+    ssize_t sent;
+
+    UNUSED(devicespec);
+    host.stats.net_sends++;
+    while (len) {
+        sent = send(host.net_socket, buf, len, 0);
+        if (sent <= 0) {
+            return FN_ERR_IO_ERROR;
+        }
+        buf += sent;
+        len -= sent;
+    }
+    return FN_ERR_OK;
+}
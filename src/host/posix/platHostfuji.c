@@ -0,0 +1,60 @@
+/*
+ *  platHostfuji.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ *  The host side of src/fujinet, for the host-net build.  poll() stands in
+ *  for the Atari's PROCEED line, and the app quits once the server has
+ *  hung up and everything it sent has been read.
+ */
+
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#include "../../global.h"
+
+#include "../platHost.h"
+
+#include "../../fujinet/fujinet.h"
+
+// How long plat_fuji_poll waits for data, so an idle run doesn't spin
+#define HOST_POLL_MS            1
+
+/*-----------------------------------------------------------------------*/
+void plat_fuji_init() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_fuji_connected() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_fuji_disconnect() {
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_fuji_poll() {
+    struct pollfd pfd;
+    char peek;
+
+    if (host.net_socket < 0) {
+        return FUJI_POLL_NO;
+    }
+    pfd.fd = host.net_socket;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, HOST_POLL_MS) <= 0) {
+        return FUJI_POLL_NO;
+    }
+    if (recv(host.net_socket, &peek, 1, MSG_PEEK | MSG_DONTWAIT) == 0) {
+        global.app.quit = true;
+    }
+    return FUJI_POLL_YES;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_fuji_ascii(char *dest, const char *text, int len) {
+    memcpy(dest, text, len);
+}
@@ -28,7 +28,16 @@ static const char *log_mempbrk(const char *buf, int len, const char *delims) {
 }
 
 /*-----------------------------------------------------------------------*/
-static inline void log_advance_line(tLog *log) {
+// The row at head now holds used chars - note that and move to the next row
+static inline void log_advance_line(tLog *log, uint8_t used) {
+    log->used[log->head] = used;
+    if (log->size >= log->rows) {
+        // The log scrolls, so every row on screen changes
+        memset(log->dirty, true, log->rows);
+    } else {
+        // Not full yet, so buffer rows are screen rows
+        log->dirty[log->head] = true;
+    }
     if (++log->head >= log->rows) {
         log->head = 0;
         log->dest_ptr = log->buffer;
@@ -45,10 +54,15 @@ void log_clear(tLog *log) {
     log->head = log->size = 0;
     log->dest_ptr = log->buffer;
     log->modified = false;
+    memset(log->dirty, false, sizeof(log->dirty));
 }
 
 /*-----------------------------------------------------------------------*/
 void log_init(tLog *log, uint8_t width, uint8_t height) {
+    if (height > LOG_MAX_ROWS) {
+        // The per row arrays can't hold more
+        plat_core_exit();
+    }
     log->cols = width;
     log->rows = height;
     log->buffer_size = width * height;
@@ -59,10 +73,13 @@ void log_init(tLog *log, uint8_t width, uint8_t height) {
         plat_core_exit();
     }
     memset(log->buffer, ' ', log->buffer_size);
+    memset(log->used, 0, sizeof(log->used));
+    memset(log->shown, 0, sizeof(log->shown));
+    memset(log->dirty, false, sizeof(log->dirty));
 }
 
 /*-----------------------------------------------------------------------*/
-void log_add_line(tLog *log, const char *text, int text_len) {
+static void log_format(tLog *log, const char *text, int text_len) {
     int remaining, chunk_len, line_len;
     const char *p = text;
     const char *line_start;
@@ -100,7 +117,7 @@ void log_add_line(tLog *log, const char *text, int text_len) {
             if (line_len == 0) {
                 memset(log->dest_ptr, ' ', log->cols);
             }
-            log_advance_line(log);
+            log_advance_line(log, 0);
         } else {
             while (line_len > 0) {
                 chunk_len = (line_len > log->cols) ? log->cols : line_len;
@@ -111,10 +128,133 @@ void log_add_line(tLog *log, const char *text, int text_len) {
                 }
                 line_start += chunk_len;
                 line_len -= chunk_len;
-                log_advance_line(log);
+                log_advance_line(log, chunk_len);
+            }
+        }
+    }
+    log->modified = true;
+}
+
+/*-----------------------------------------------------------------------*/
+void log_add_line(tLog *log, const char *text, int text_len) {
+    // Anything captured earlier goes first
+    log_flush(log);
+    log_format(log, text, text_len);
+}
+
+/*-----------------------------------------------------------------------*/
+// Keep text in the raw buffer without formatting it.  It is only split into
+// rows by log_flush, i.e. when someone is going to look at the log.  If raw
+// fills up, the oldest lines are dropped
+void log_capture(tLog *log, const char *text, int text_len) {
+    unsigned int drop, i, part;
+    const char *newline;
+
+    if (!log->raw) {
+        log_add_line(log, text, text_len);
+        return;
+    }
+    if (text_len < 0) {
+        text_len = strlen(text);
+    }
+    if ((unsigned int)text_len > log->raw_size) {
+        // Only the end fits, so that replaces everything, from the start of
+        // a line if there is one in it
+        drop = text_len - log->raw_size;
+        if ((newline = memchr(text + drop, '\x0a', log->raw_size))) {
+            drop = newline + 1 - text;
+            if ((int)drop < text_len && text[drop] == '\x0d') {
+                ++drop;
+            }
+        }
+        text += drop;
+        text_len -= drop;
+        log->raw_head = log->raw_used = 0;
+        log->raw_lost = true;
+    }
+    if (log->raw_used + text_len > log->raw_size) {
+        // Make room, and drop to the end of a line so the log starts on a new line
+        drop = log->raw_used + text_len - log->raw_size;
+        i = log->raw_head + drop;
+        if (i >= log->raw_size) {
+            i -= log->raw_size;
+        }
+        while (drop < log->raw_used && log->raw[i] != '\x0a') {
+            ++drop;
+            if (++i >= log->raw_size) {
+                i = 0;
+            }
+        }
+        // Past the newline, and the '\x0d' FICS puts after it
+        if (drop < log->raw_used) {
+            ++drop;
+            if (++i >= log->raw_size) {
+                i = 0;
+            }
+            if (drop < log->raw_used && log->raw[i] == '\x0d') {
+                ++drop;
             }
         }
+        log->raw_head += drop;
+        if (log->raw_head >= log->raw_size) {
+            log->raw_head -= log->raw_size;
+        }
+        log->raw_used -= drop;
+        log->raw_lost = true;
+    }
+    // Add at the tail, which may wrap around to the start of raw
+    i = log->raw_head + log->raw_used;
+    if (i >= log->raw_size) {
+        i -= log->raw_size;
+    }
+    part = log->raw_size - i;
+    if (part > (unsigned int)text_len) {
+        part = text_len;
+    }
+    memcpy(log->raw + i, text, part);
+    memcpy(log->raw, text + part, text_len - part);
+    log->raw_used += text_len;
+}
+
+/*-----------------------------------------------------------------------*/
+// Format whatever log_capture kept into rows, in two parts if it wraps
+// around the end of raw
+void log_flush(tLog *log) {
+    unsigned int part;
+
+    if (!log->raw_used) {
+        return;
+    }
+    if (log->raw_lost) {
+        // What's in raw doesn't follow on from what's in the log, so show
+        // that something is missing between the two
+        log_format(log, "...", 3);
+        log->raw_lost = false;
     }
+    part = log->raw_size - log->raw_head;
+    if (part > log->raw_used) {
+        part = log->raw_used;
+    }
+    log_format(log, log->raw + log->raw_head, part);
+    if (log->raw_used > part) {
+        log_format(log, log->raw, log->raw_used - part);
+    }
+    log->raw_head = log->raw_used = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void log_init_raw(tLog *log, char *raw, unsigned int raw_size) {
+    log->raw = raw;
+    log->raw_size = raw_size;
+    log->raw_head = log->raw_used = 0;
+    log->raw_lost = false;
+}
+
+/*-----------------------------------------------------------------------*/
+// Draw every row in full next time, for when what's on screen is not known
+void log_invalidate(tLog *log) {
+    memset(log->dirty, true, sizeof(log->dirty));
+    memset(log->shown, 0xFF, sizeof(log->shown));
     log->modified = true;
 }
 
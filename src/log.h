@@ -10,6 +10,9 @@
 #ifndef LOG_H
 #define LOG_H
 
+// Most rows a log can have
+#define LOG_MAX_ROWS    25
+
 typedef struct _tLog {
     char *buffer;               // Log data storage
     unsigned int buffer_size;   // Size of buffer in bytes
@@ -20,11 +23,23 @@ typedef struct _tLog {
     uint8_t rows;               // How many rows before wrapping
     bool modified;              // log_add_* sets to 1
     bool clip;                  // log_add_line copies onlt cols chars
+    char *raw;                  // Optional - text kept as is by log_capture
+    unsigned int raw_size;      // Size of raw in bytes
+    unsigned int raw_head;      // Where in raw the oldest byte is.  raw is a ring
+    unsigned int raw_used;      // Bytes in raw not yet formatted into buffer
+    bool raw_lost;              // raw overflowed so its start doesn't follow on from buffer
+    bool dirty[LOG_MAX_ROWS];   // Per screen row, needs drawing
+    uint8_t used[LOG_MAX_ROWS]; // Per buffer row, chars before the padding spaces
+    uint8_t shown[LOG_MAX_ROWS];// Per screen row, chars plat_draw_log last drew
 } tLog;
 
 void log_add_line(tLog *log, const char *text, int text_len);
+void log_capture(tLog *log, const char *text, int text_len);
 void log_clear(tLog *log);
+void log_flush(tLog *log);
 void log_init(tLog *log, uint8_t width, uint8_t height);
+void log_init_raw(tLog *log, char *raw, unsigned int raw_size);
+void log_invalidate(tLog *log);
 void log_shutdown(tLog *log);
 
 #endif // LOG_H
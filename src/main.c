@@ -9,9 +9,13 @@
 
 #include "global.h"
 
+// Server text waiting to be formatted into the terminal log
+static char terminal_raw[1024];
+
 /*-----------------------------------------------------------------------*/
 int main() {
     log_init(&global.view.terminal, 80, plat_core_get_rows() - 1);
+    log_init_raw(&global.view.terminal, terminal_raw, sizeof(terminal_raw));
     log_init(&global.view.info_panel, plat_core_get_cols() - plat_core_get_status_x(), plat_core_get_rows());
 
     plat_core_init();
@@ -271,6 +271,8 @@ uint8_t menu_tick() {
     menu_draw_set_text_bg_color(MENU_COLOR_BACKGROUND);
 
     if (global.view.mc.df & MENU_DRAW) {
+        // Let the platform keep what the menu covers, so the erase is cheap
+        plat_draw_save_under();
         // Totally draw menu.  Start with frame and blank background
         menu_draw_rect(global.view.mc.x, global.view.mc.y, global.view.mc.w, 1, MENU_COLOR_FRAME);
         menu_draw_rect(global.view.mc.x, global.view.mc.y + global.view.mc.h - 1, global.view.mc.w, 1, MENU_COLOR_FRAME);
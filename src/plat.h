@@ -42,9 +42,10 @@ void plat_draw_board(void);
 void plat_draw_clear_input_line(bool active);
 void plat_draw_clear_statslog_area(uint8_t row);
 void plat_draw_clrscr(void);
-void plat_draw_highlight(uint8_t position, uint8_t color);
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool use_color);
+void plat_draw_markers(uint8_t cursor, uint8_t selected);
 void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color);
+void plat_draw_save_under(void);
 void plat_draw_set_color(uint8_t color);
 void plat_draw_set_text_bg_color(uint8_t color);
 void plat_draw_splash_screen(void);
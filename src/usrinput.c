@@ -106,12 +106,12 @@ void input_text(char *buffer, uint8_t buffer_len, uint8_t filter) {
 
             case INPUT_VIEW_PAN_LEFT:
                 global.view.pan_value--;
-                global.view.terminal.modified = true;
+                log_invalidate(&global.view.terminal);
                 break;
 
             case INPUT_VIEW_PAN_RIGHT:
                 global.view.pan_value++;
-                global.view.terminal.modified = true;
+                log_invalidate(&global.view.terminal);
                 break;
 
             case INPUT_KEY: {
@@ -0,0 +1,558 @@
+#
+#  ficsserver.py
+#  RetroMate
+#
+#  A local stand-in for freechess.org, for testing the client's parsing
+#  speed, time to board and behaviour under a flood, without the real
+#  server.  It speaks just enough FICS for fics.c: the login prompts, the
+#  "set" replies, sought listings, and games streamed as style 12 lines,
+#  with "says:", "{Game ...}" and "Removing game" events.
+#
+#  Run:  python3 util/ficsserver.py [options]   (--help lists them)
+#  and point the FujiNet, or 'make host-net' with RETROMATE_SERVER, at it.
+#  For example, to flood the host build with 20 games and then hang up:
+#    python3 util/ficsserver.py --autostart --games 20 --rate 0 --hangup &
+#    RETROMATE_SERVER=localhost:5000 r2r/host/retromat-net
+#
+#  This is free and unencumbered software released into the public domain.
+#
+
+import argparse
+import datetime
+import os
+import random
+import select
+import socket
+import sys
+import threading
+import time
+
+LISTEN_HOST = '0.0.0.0'
+LISTEN_PORT = 5000
+
+# FICS ends lines with "\n\r", and prompts with no end of line at all
+EOL = "\n\r"
+PROMPT = "fics% "
+
+TELNET_WILL_ECHO = b"\xff\xfb\x01"
+TELNET_WONT_ECHO = b"\xff\xfc\x01"
+
+OPPONENT = "Opponent"
+
+# Same as util/proxy.py writes, so 'make host' can play sessions back
+TRANSCRIPT_HEADER = b"# RetroMate transcript\n"
+
+# The game every game is: Morphy's opera game, as (from, to, promotion),
+# the verbose piece letter and the short notation.  White wins.
+GAME = [
+    ("e2e4", "P", "e4"),    ("e7e5", "P", "e5"),    ("g1f3", "N", "Nf3"),   ("d7d6", "P", "d6"),
+    ("d2d4", "P", "d4"),    ("c8g4", "B", "Bg4"),   ("d4e5", "P", "dxe5"),  ("g4f3", "B", "Bxf3"),
+    ("d1f3", "Q", "Qxf3"),  ("d6e5", "P", "dxe5"),  ("f1c4", "B", "Bc4"),   ("g8f6", "N", "Nf6"),
+    ("f3b3", "Q", "Qb3"),   ("d8e7", "Q", "Qe7"),   ("b1c3", "N", "Nc3"),   ("c7c6", "P", "c6"),
+    ("c1g5", "B", "Bg5"),   ("b7b5", "P", "b5"),    ("c3b5", "N", "Nxb5"),  ("c6b5", "P", "cxb5"),
+    ("c4b5", "B", "Bxb5+"), ("b8d7", "N", "Nbd7"),  ("e1c1", "K", "O-O-O"), ("a8d8", "R", "Rd8"),
+    ("d1d7", "R", "Rxd7"),  ("d8d7", "R", "Rxd7"),  ("h1d1", "R", "Rd1"),   ("e7e6", "Q", "Qe6"),
+    ("b5d7", "B", "Bxd7+"), ("f6d7", "N", "Nxd7"),  ("b3b8", "Q", "Qb8+"),  ("d7b8", "N", "Nxb8"),
+    ("d1d8", "R", "Rd8#"),
+]
+GAME_RESULT = "checkmated} 1-0"
+
+START_POSITION = [
+    "rnbqkbnr", "pppppppp", "--------", "--------",
+    "--------", "--------", "PPPPPPPP", "RNBQKBNR",
+]
+
+SAYINGS = [
+    "hi",
+    "good luck, have fun",
+    "are you on an 8-bit machine?  This line is long enough to need wrapping in the status area",
+    "nice move",
+    "gg",
+]
+
+SOUGHT_NAMES = ["Pawnstorm", "Knightly", "Bishop(C)", "RookieRook", "QueenGambit", "Endgamer",
+                "Zugzwang", "Fianchetto", "Castler(C)", "Tempo"]
+SOUGHT_TIMES = [(1, 0), (2, 12), (3, 0), (5, 0), (5, 2), (15, 0), (15, 5), (45, 45), (0, 0)]
+SOUGHT_VARIANTS = ["crazyhouse", "suicide", "wild/fr"]
+
+
+class Transcript:
+    """Timestamped record of both directions of one session."""
+    def __init__(self, directory):
+        name = datetime.datetime.now().strftime("session-%Y%m%d-%H%M%S-%f.txt")
+        self.file = open(os.path.join(directory, name), "wb")
+        self.file.write(TRANSCRIPT_HEADER)
+        self.start = time.monotonic()
+
+    def write(self, data, direction):
+        self.file.write(b"%.3f %s %d\n" % (time.monotonic() - self.start, direction, len(data)))
+        self.file.write(data)
+        self.file.write(b"\n")
+
+    def close(self):
+        self.file.close()
+
+
+class Position:
+    """Just enough of a board to play GAME out and describe it in style 12."""
+    def __init__(self):
+        self.rows = [list(row) for row in START_POSITION]
+        self.white_to_move = True
+        self.double_pawn_push = -1
+        self.castle = {"K": 1, "Q": 1, "k": 1, "q": 1}
+        self.irreversible = 0
+        self.move_number = 1
+        self.verbose = "none"
+        self.pretty = "none"
+
+    def square(self, name):
+        return 8 - int(name[1]), ord(name[0]) - ord("a")
+
+    def play(self, move, piece, pretty):
+        (fr, ff), (tr, tf) = self.square(move[0:2]), self.square(move[2:4])
+        moving = self.rows[fr][ff]
+        captured = self.rows[tr][tf]
+        if moving in "Pp" and ff != tf and captured == "-":
+            # En passant
+            self.rows[fr][tf] = "-"
+            captured = "p"
+        self.rows[tr][tf] = moving
+        self.rows[fr][ff] = "-"
+        if len(move) > 4:
+            self.rows[tr][tf] = move[4].upper() if moving == "P" else move[4]
+        if moving in "Kk" and abs(tf - ff) == 2:
+            # Castling moves the rook too
+            rook_from, rook_to = (7, 5) if tf > ff else (0, 3)
+            self.rows[tr][rook_to] = self.rows[tr][rook_from]
+            self.rows[tr][rook_from] = "-"
+            self.verbose = "o-o" if tf > ff else "o-o-o"
+        else:
+            self.verbose = f"{piece}/{move[0:2]}-{move[2:4]}"
+        if moving in "Kk":
+            side = "KQ" if moving == "K" else "kq"
+            for right in side:
+                self.castle[right] = 0
+        for corner, right in (("a1", "Q"), ("h1", "K"), ("a8", "q"), ("h8", "k")):
+            if corner in (move[0:2], move[2:4]):
+                self.castle[right] = 0
+        self.double_pawn_push = tf if moving in "Pp" and abs(tr - fr) == 2 else -1
+        self.irreversible = 0 if moving in "Pp" or captured != "-" else self.irreversible + 1
+        if not self.white_to_move:
+            self.move_number += 1
+        self.white_to_move = not self.white_to_move
+        self.pretty = pretty
+
+    def style12(self, game_number, white, black, relation, minutes, increment, clocks, flip):
+        board = " ".join("".join(row) for row in self.rows)
+        return (f"<12> {board} {'W' if self.white_to_move else 'B'} {self.double_pawn_push}"
+                f" {self.castle['K']} {self.castle['Q']} {self.castle['k']} {self.castle['q']}"
+                f" {self.irreversible} {game_number} {white} {black} {relation} {minutes} {increment}"
+                f" 39 39 {clocks[0]} {clocks[1]} {self.move_number} {self.verbose} (0:01) {self.pretty}"
+                f" {flip} 1 0")
+
+
+class Session:
+    """One client connection: the login, then commands and a game at a time."""
+    def __init__(self, sock, addr, options, number):
+        self.sock = sock
+        self.options = options
+        self.name = f"{addr[0]}:{addr[1]}"
+        self.random = random.Random(options.seed + number)
+        self.transcript = Transcript(options.transcript) if options.transcript else None
+        self.start = time.monotonic()
+        self.received = b""
+        self.state = "login"
+        self.user = None
+        self.registered = False
+        self.minutes = 15
+        self.increment = 0
+        self.plays = 0
+        self.games_played = 0
+        self.game = None
+        self.next_update = None
+        self.open = True
+        self.bytes_sent = 0
+        self.boards_sent = 0
+        self.sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+
+    def log(self, text):
+        print(f"[{time.monotonic() - self.start:8.3f} {self.name}] {text}")
+
+    # -- Sending --------------------------------------------------------
+
+    def send_bytes(self, data):
+        """Send data cut up as --split says, pausing --gap between the pieces
+        so they show up at the client as separate reads."""
+        split = self.options.split
+        if split == "none":
+            pieces = [data]
+        elif split == "line":
+            pieces = [piece + b"\n" for piece in data.split(b"\n")]
+            pieces[-1] = pieces[-1][:-1]
+        else:
+            pieces = []
+            while data:
+                size = self.random.randint(1, 64) if split == "random" else int(split)
+                pieces.append(data[:size])
+                data = data[size:]
+        first = True
+        for piece in pieces:
+            if not piece:
+                continue
+            if not first and self.options.gap:
+                time.sleep(self.options.gap)
+            first = False
+            self.sock.sendall(piece)
+            self.bytes_sent += len(piece)
+            if self.transcript:
+                self.transcript.write(piece, b"S")
+
+    def send(self, *lines, prompt=True):
+        """Send lines the way FICS does, each starting on a fresh line, and
+        then (usually) the prompt."""
+        text = "".join(EOL + line for line in lines)
+        if prompt:
+            text += EOL + PROMPT
+        self.send_bytes(text.encode("ascii"))
+
+    # -- Login ------------------------------------------------------------
+
+    def welcome(self):
+        self.send_bytes(("Welcome to the RetroMate test server (not the Free Internet Chess Server)." + EOL +
+                         "Logging in as \"guest\" makes a guest account." + EOL + EOL + "login: ").encode("ascii"))
+
+    def login(self, line):
+        name = line.strip()
+        if not name.isalpha() or len(name) > 17:
+            self.send_bytes((f"Sorry, names can only consist of lower and upper case letters.  Try again.{EOL}"
+                             f"login: ").encode("ascii"))
+            return
+        password = self.options.users.get(name.lower())
+        if password is not None:
+            self.user = name
+            self.registered = True
+            self.state = "password"
+            self.send_bytes(f"{EOL}\"{name}\" is a registered name.  If it is yours, type the password.{EOL}"
+                            f"If not, just hit return to try another name.{EOL}{EOL}password: ".encode("ascii"))
+            if self.options.telnet:
+                self.send_bytes(TELNET_WILL_ECHO)
+            return
+        if name.lower() == "guest":
+            name = "Guest" + "".join(self.random.choice("ABCDEFGHIJKLMNOPQRSTUVWXYZ") for _ in range(4))
+        self.user = name
+        self.state = "confirm"
+        self.send_bytes(f"{EOL}\"{name}\" is not a registered name.  You may use this name to play unrated games."
+                        f"{EOL}(After logging in, do \"help register\" for more info on how to register.){EOL}{EOL}"
+                        f"Press return to enter the server as \"{name}\": ".encode("ascii"))
+
+    def password(self, line):
+        if self.options.telnet:
+            self.send_bytes(TELNET_WONT_ECHO)
+        if line != self.options.users[self.user.lower()]:
+            self.send_bytes(f"{EOL}**** Invalid password! ****{EOL}{EOL}".encode("ascii"))
+            self.close()
+            return
+        self.logged_in()
+
+    def logged_in(self):
+        suffix = "" if self.registered else "(U)"
+        self.state = "online"
+        self.log(f"logged in as {self.user}")
+        self.send(f"**** Starting FICS session as {self.user}{suffix} ****")
+
+    # -- Commands -----------------------------------------------------------
+
+    def command(self, line):
+        words = line.split()
+        if not words:
+            self.send(prompt=True)
+            return
+        verb = words[0].lower()
+        handler = getattr(self, "cmd_" + verb, None)
+        if handler:
+            handler(words[1:])
+        elif len(verb) in (4, 5) and verb[0] in "abcdefgh" and verb[1] in "12345678":
+            # A move - the game plays itself, so it's only noted
+            self.log(f"move {verb} (ignored)")
+        else:
+            self.send(f"{verb}: Command not found.")
+
+    def cmd_set(self, args):
+        if len(args) < 2:
+            self.send("Usage: set <variable> <value>")
+            return
+        variable, value = args[0].lower(), args[1]
+        replies = {
+            "bell": "Bell off." if value == "0" else "Bell on.",
+            "seek": "You will not see seek ads." if value == "0" else "You will now see seek ads.",
+            "style": f"Style {value} set.",
+            "autoflag": "Auto-flagging enabled." if value == "1" else "Auto-flagging disabled.",
+            "time": f"Default time set to {value}.",
+            "inc": f"Default increment set to {value}.",
+            "availmin": f"You will be notified of availability with blitz ratings {value} - 9999.",
+            "availmax": f"You will be notified of availability with blitz ratings 0 - {value}.",
+            "rated": "Games will be rated by default." if value == "1" else "Games will be unrated by default.",
+        }
+        if variable == "time" and value.isdigit():
+            self.minutes = int(value)
+        elif variable == "inc" and value.isdigit():
+            self.increment = int(value)
+        self.send(replies.get(variable, f"No such variable \"{variable}\"."))
+        # "Default increment set to" is what brings RetroMate online, so a
+        # game sent before it would be lost
+        if variable == "inc" and self.options.autostart and not self.game and not self.games_played:
+            self.start_game()
+
+    def cmd_sought(self, args):
+        lines = []
+        for index in range(1, self.options.sought + 1):
+            minutes, increment = self.random.choice(SOUGHT_TIMES)
+            if self.random.random() < 0.15:
+                game_type = self.random.choice(SOUGHT_VARIANTS)
+            elif minutes == 0:
+                game_type = "untimed"
+            elif minutes + increment * 2 / 3 < 3:
+                game_type = "lightning"
+            elif minutes + increment * 2 / 3 < 15:
+                game_type = "blitz"
+            else:
+                game_type = "standard"
+            rated = "rated" if self.random.random() < 0.5 else "unrated"
+            rating = str(self.random.randint(800, 2300)) if self.random.random() < 0.8 else "++++"
+            color = self.random.choice(["", "", "", "[white]", "[black]"])
+            extra = self.random.choice(["", "", "", "m", "f", "m f"])
+            name = self.random.choice(SOUGHT_NAMES)
+            lines.append(f"{index:3} {rating:>4} {name:<17} {minutes:3} {increment:3} {rated:<7} {game_type:<10} "
+                         f"{color:<7} {'0-9999':>9} {extra}".rstrip())
+        lines.append(f"{self.options.sought} ads displayed.")
+        self.send(*lines)
+
+    def cmd_play(self, args):
+        self.plays += 1
+        if self.game or self.plays <= self.options.gone or not args or not args[0].isdigit() or \
+                not 1 <= int(args[0]) <= self.options.sought:
+            self.send("That seek is not available.")
+            return
+        self.start_game()
+
+    def cmd_seek(self, args):
+        self.send("Your seek has been posted with index 7.", "(1 player(s) saw the seek.)")
+        if not self.game:
+            self.start_game()
+
+    def cmd_unseek(self, args):
+        self.send("Your seeks have been removed.")
+
+    def cmd_refresh(self, args):
+        if self.game:
+            self.send(self.game_style12())
+        else:
+            self.send("You are neither playing, observing nor examining a game.")
+
+    def cmd_resign(self, args):
+        if self.game and self.game["relation"]:
+            self.end_game(f"{self.user} resigns}} {'0-1' if self.game['white'] == self.user else '1-0'}")
+        else:
+            self.send("You are not playing a game.")
+
+    def cmd_unobserve(self, args):
+        if self.game and not self.game["relation"]:
+            number = self.game["number"]
+            self.game = None
+            self.send(f"Removing game {number} from observation list.")
+        else:
+            self.send("You are not observing any games.")
+
+    def cmd_quit(self, args):
+        self.goodbye()
+
+    # -- Games --------------------------------------------------------------
+
+    def start_game(self):
+        number = 100 + self.games_played
+        white, black = (self.user, OPPONENT) if self.games_played % 2 == 0 else (OPPONENT, self.user)
+        if self.options.observe:
+            white, black = OPPONENT, "Observed"
+        self.game = {
+            "number": number,
+            "white": white,
+            "black": black,
+            "relation": 0 if self.options.observe else 1,
+            "position": Position(),
+            "ply": 0,
+        }
+        self.games_played += 1
+        rated = "unrated"
+        self.log(f"game {number} {white} vs. {black}")
+        self.send(f"Creating: {white} (++++) {black} (++++) {rated} standard {self.minutes} {self.increment}",
+                  f"{{Game {number} ({white} vs. {black}) Creating {rated} standard match.}}",
+                  "",
+                  self.game_style12())
+        self.next_update = time.monotonic() + self.delay()
+
+    def delay(self):
+        return 1.0 / self.options.rate if self.options.rate else 0
+
+    def game_style12(self):
+        game = self.game
+        position = game["position"]
+        if game["relation"]:
+            # 1 when it's my move, -1 when it's the opponent's
+            mine = (game["white"] == self.user) == position.white_to_move
+            relation = 1 if mine else -1
+        else:
+            relation = 0
+        seconds = self.minutes * 60 - game["ply"] // 2
+        self.boards_sent += 1
+        return position.style12(game["number"], game["white"], game["black"], relation,
+                                self.minutes, self.increment, (seconds, seconds), int(game["black"] == self.user))
+
+    def update(self):
+        """The next move of the game, or its end."""
+        game = self.game
+        if game["ply"] >= len(GAME):
+            loser = game["black"]
+            self.end_game(f"{loser} {GAME_RESULT}")
+            return
+        move, piece, pretty = GAME[game["ply"]]
+        game["position"].play(move, piece, pretty)
+        game["ply"] += 1
+        lines = [self.game_style12()]
+        if self.options.say and game["ply"] % self.options.say == 0:
+            lines.append(f"{OPPONENT} says: {SAYINGS[(game['ply'] // self.options.say) % len(SAYINGS)]}")
+        self.send(*lines)
+        self.next_update = time.monotonic() + self.delay()
+
+    def end_game(self, result):
+        game = self.game
+        lines = [f"{{Game {game['number']} ({game['white']} vs. {game['black']}) {result}"]
+        if not game["relation"]:
+            lines.append(f"Removing game {game['number']} from observation list.")
+        self.game = None
+        self.next_update = None
+        self.send(*lines)
+        if self.games_played < self.options.games:
+            if self.options.autostart:
+                self.start_game()
+        elif self.options.hangup:
+            self.goodbye()
+
+    # -- Connection -------------------------------------------------------
+
+    def goodbye(self):
+        self.send_bytes((EOL + "Logging you out." + EOL + EOL +
+                         "Thank you for using the Free Internet Chess server (http://www.freechess.org)." +
+                         EOL).encode("ascii"))
+        self.close()
+
+    def close(self):
+        if not self.open:
+            return
+        self.open = False
+        elapsed = time.monotonic() - self.start
+        self.log(f"closed: {self.boards_sent} boards, {self.bytes_sent} bytes in {elapsed:.3f} s")
+        try:
+            self.sock.shutdown(socket.SHUT_RDWR)
+        except OSError:
+            pass
+        self.sock.close()
+        if self.transcript:
+            self.transcript.close()
+
+    def lines(self):
+        """Complete lines from the client, without their line ends."""
+        while b"\n" in self.received:
+            line, self.received = self.received.split(b"\n", 1)
+            yield line.rstrip(b"\r").decode("ascii", errors="replace")
+
+    def run(self):
+        self.log("connected")
+        try:
+            self.welcome()
+            while self.open:
+                timeout = None
+                if self.next_update is not None:
+                    timeout = max(0, self.next_update - time.monotonic())
+                readable, _, _ = select.select([self.sock], [], [], timeout)
+                if readable:
+                    data = self.sock.recv(4096)
+                    if not data:
+                        break
+                    if self.transcript:
+                        self.transcript.write(data, b"C")
+                    self.received += data
+                    for line in self.lines():
+                        self.log(f"<- {line}")
+                        if self.state == "login":
+                            self.login(line)
+                        elif self.state == "password":
+                            self.password(line)
+                        elif self.state == "confirm":
+                            self.logged_in()
+                        else:
+                            self.command(line)
+                        if not self.open:
+                            break
+                if self.open and self.game and self.next_update is not None and time.monotonic() >= self.next_update:
+                    self.update()
+        except (ConnectionResetError, BrokenPipeError) as e:
+            self.log(f"connection lost: {e}")
+        finally:
+            self.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Local FICS stand-in for testing RetroMate.")
+    parser.add_argument("--host", default=LISTEN_HOST, help="address to listen on (default all)")
+    parser.add_argument("--port", type=int, default=LISTEN_PORT, help="port to listen on (default 5000)")
+    parser.add_argument("--user", action="append", default=[], metavar="NAME:PASSWORD",
+                        help="a registered account (can be given more than once)")
+    parser.add_argument("--sought", type=int, default=20, metavar="N", help="ads in each sought listing")
+    parser.add_argument("--gone", type=int, default=0, metavar="N",
+                        help="answer the first N play commands with \"That seek is not available.\"")
+    parser.add_argument("--rate", type=float, default=1.0,
+                        help="style 12 updates per second, 0 for as fast as possible (default 1)")
+    parser.add_argument("--games", type=int, default=1, metavar="N",
+                        help="games before --hangup; with --autostart they follow on from each other")
+    parser.add_argument("--autostart", action="store_true", help="start a game once the client is online (has done \"set inc\")")
+    parser.add_argument("--observe", action="store_true",
+                        help="the client observes the games instead of playing in them")
+    parser.add_argument("--say", type=int, default=0, metavar="N",
+                        help="the opponent says something every N moves (default never)")
+    parser.add_argument("--split", default="none",
+                        help="cut what is sent into: none, line, random (1-64 bytes) or a number of bytes")
+    parser.add_argument("--gap", type=float, default=0.002,
+                        help="seconds between the pieces of a split send (default 0.002)")
+    parser.add_argument("--telnet", action="store_true", help="send telnet ECHO options around the password")
+    parser.add_argument("--hangup", action="store_true", help="log the client out after the last game")
+    parser.add_argument("--seed", type=int, default=1, help="seed for guest names, ads and random splits")
+    parser.add_argument("--transcript", metavar="DIR",
+                        help="write a util/proxy.py style transcript of each session to DIR")
+    options = parser.parse_args()
+    if options.split not in ("none", "line", "random") and not options.split.isdigit():
+        parser.error("--split must be none, line, random or a number")
+    options.users = {}
+    for user in options.user:
+        name, _, password = user.partition(":")
+        options.users[name.lower()] = password
+
+    server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+    server.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+    server.bind((options.host, options.port))
+    server.listen(5)
+    print(f"[*] FICS stand-in listening on {options.host}:{options.port}")
+
+    number = 0
+    while True:
+        client_socket, addr = server.accept()
+        session = Session(client_socket, addr, options, number)
+        number += 1
+        threading.Thread(target=session.run, daemon=True).start()
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        print("\n[*] FICS stand-in shutting down.")
+        sys.exit(0)
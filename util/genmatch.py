@@ -0,0 +1,137 @@
+#
+#  genmatch.py
+#  RetroMate
+#
+#  Builds the tables for the FICS trigger matcher in src/ficsmatch.h
+#  Run from the repo root:  python3 util/genmatch.py > src/ficsmatch.h
+#
+#  This is free and unencumbered software released into the public domain.
+#
+
+# Triggers that FICS only ever sends at the start of a line.  These are
+# checked once per line (after any '\r') and not scanned for elsewhere.
+ANCHORED = [
+    ("STYLE12",      "<12>"),
+    ("GAME_OVER",    "{Game "),
+    ("REMOVING",     "Removing game"),
+    ("PASSWORD",     "password:"),
+]
+
+# Triggers that can be anywhere in a line.  These are found with an
+# Aho-Corasick automaton so every byte of a line is looked at only once.
+UNANCHORED = [
+    ("SAYS",         "says: "),
+    ("QUIESCENCE",   "nor examining a game."),
+    ("REGISTERED",   "Starting FICS"),
+    ("BAD_PASSWORD", "Invalid password!"),
+    ("LOGGED_IN",    "enter the server as \""),
+    ("SEEK_GONE",    "That seek is not available."),
+]
+
+
+class Node:
+    def __init__(self, char):
+        self.char = char
+        self.children = []
+        self.fail = 0
+        self.out = 0
+
+
+def add(nodes, root, text, out):
+    state = root
+    for c in text:
+        for child in nodes[state].children:
+            if nodes[child].char == c:
+                state = child
+                break
+        else:
+            nodes.append(Node(c))
+            nodes[state].children.append(len(nodes) - 1)
+            state = len(nodes) - 1
+    nodes[state].out = out
+
+
+def goto(nodes, state, c):
+    for child in nodes[state].children:
+        if nodes[child].char == c:
+            return child
+    return None
+
+
+def main():
+    names = [name for name, _ in ANCHORED + UNANCHORED]
+
+    # Node 0 is the Aho-Corasick root, node 1 the root of the anchored trie.
+    # Index 0 doubles as "no child/sibling" since the root is never a child.
+    nodes = [Node(None), Node(None)]
+    for name, text in UNANCHORED:
+        add(nodes, 0, text, names.index(name) + 1)
+    for name, text in ANCHORED:
+        add(nodes, 1, text, names.index(name) + 1)
+    assert len(nodes) < 256
+
+    # Failure links, breadth first from the Aho-Corasick root
+    queue = list(nodes[0].children)
+    while queue:
+        state = queue.pop(0)
+        for child in nodes[state].children:
+            queue.append(child)
+            fail = nodes[state].fail
+            while fail and goto(nodes, fail, nodes[child].char) is None:
+                fail = nodes[fail].fail
+            target = goto(nodes, fail, nodes[child].char)
+            nodes[child].fail = target if target is not None and target != child else 0
+            if not nodes[child].out:
+                nodes[child].out = nodes[nodes[child].fail].out
+
+    first = [0] * 128
+    for child in nodes[0].children:
+        first[ord(nodes[child].char)] = child
+
+    def sibling(i):
+        for n in nodes:
+            if i in n.children:
+                idx = n.children.index(i)
+                return n.children[idx + 1] if idx + 1 < len(n.children) else 0
+        return 0
+
+    def table(name, values):
+        print("static const uint8_t %s[%d] = {" % (name, len(values)))
+        for i in range(0, len(values), 16):
+            print("    " + " ".join("0x%02X," % v for v in values[i:i + 16]))
+        print("};")
+        print()
+
+    print("/*")
+    print(" *  ficsmatch.h")
+    print(" *  RetroMate")
+    print(" *")
+    print(" *  Generated by util/genmatch.py - do not edit.")
+    print(" *  This is free and unencumbered software released into the public domain.")
+    print(" *")
+    print(" */")
+    print()
+    print("#ifndef _FICSMATCH_H_")
+    print("#define _FICSMATCH_H_")
+    print()
+    print("#define FICS_MATCH_NONE                 0")
+    for i, (name, text) in enumerate(ANCHORED + UNANCHORED):
+        print("#define FICS_MATCH_%-20s %-3d // \"%s\"" % (name, i + 1, text.replace('"', '\\"')))
+    print()
+    print("#define FICS_MATCH_ROOT                 0")
+    print("#define FICS_MATCH_ANCHOR_ROOT          1")
+    print()
+    print("// Node reached from the root on each ASCII character")
+    table("fics_match_first", first)
+    print("// Per node: the (ASCII) character on the edge into it, its first child and")
+    print("// next sibling (0 = none), its failure link and the trigger that ends there")
+    table("fics_match_char", [ord(n.char) if n.char else 0 for n in nodes])
+    table("fics_match_child", [n.children[0] if n.children else 0 for n in nodes])
+    table("fics_match_sibling", [sibling(i) for i in range(len(nodes))])
+    table("fics_match_fail", [n.fail for n in nodes])
+    table("fics_match_out", [n.out for n in nodes])
+    print("#endif //_FICSMATCH_H_")
+
+
+if __name__ == "__main__":
+    main()
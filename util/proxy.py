@@ -2,6 +2,8 @@ import socket
 import threading
 import sys
 import datetime
+import os
+import time
 
 LISTEN_HOST = '0.0.0.0' # Listen on all available interfaces
 LISTEN_PORT = 6000     # The port your Atari should connect to
@@ -9,6 +11,37 @@ LISTEN_PORT = 6000     # The port your Atari should connect to
 REMOTE_HOST = 'freechess.org'
 REMOTE_PORT = 5000      # The actual freechess.org port
 
+# Run as "python3 proxy.py <dir>" to also write a transcript of each session
+# to <dir>/session-<date>-<time>.txt.  The host build (make host) plays these
+# back with RETROMATE_REPLAY.  A transcript is a header line and then, for
+# every recv, a line "<seconds since connect> <S or C> <length>" followed by
+# the raw bytes and a newline.  S is server to client, C client to server.
+TRANSCRIPT_HEADER = b"# RetroMate transcript\n"
+
+
+class Transcript:
+    """Timestamped record of both directions of one session."""
+    def __init__(self, directory):
+        name = datetime.datetime.now().strftime("session-%Y%m%d-%H%M%S.txt")
+        self.path = os.path.join(directory, name)
+        self.file = open(self.path, "wb")
+        self.file.write(TRANSCRIPT_HEADER)
+        self.start = time.monotonic()
+        self.lock = threading.Lock()
+        print(f"[*] Writing transcript to {self.path}")
+
+    def write(self, data, direction):
+        with self.lock:
+            self.file.write(b"%.3f %s %d\n" % (time.monotonic() - self.start, direction, len(data)))
+            self.file.write(data)
+            self.file.write(b"\n")
+            self.file.flush()
+
+    def close(self):
+        with self.lock:
+            self.file.close()
+
+
 def hexdump(data, direction):
     """Generates a hex dump with ASCII interpretation and highlights 0xff."""
     output = f"[{direction} {len(data)} bytes @ {datetime.datetime.now().time().isoformat()}]"
@@ -33,7 +66,7 @@ def hexdump(data, direction):
         print("\033[91m!!! DETECTED 0xFF (Telnet IAC) BYTE IN STREAM !!!\033[0m\n")
 
 
-def forward_data(source_socket, destination_socket, direction):
+def forward_data(source_socket, destination_socket, direction, transcript=None):
     """Forwards data between two sockets and logs it."""
     try:
         while True:
@@ -42,6 +75,8 @@ def forward_data(source_socket, destination_socket, direction):
                 break
             
             hexdump(data, direction)
+            if transcript:
+                transcript.write(data, b"C" if direction.startswith("C2S") else b"S")
             destination_socket.sendall(data)
             
     except ConnectionResetError:
@@ -52,20 +87,23 @@ def forward_data(source_socket, destination_socket, direction):
         source_socket.close()
 
 
-def client_handler(client_socket, remote_host, remote_port):
+def client_handler(client_socket, remote_host, remote_port, transcript_dir=None):
     """Handles a single client connection, establishing connection to remote server."""
     remote_socket = None
+    transcript = None
     try:
         remote_socket = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
         remote_socket.connect((remote_host, remote_port))
         print(f"[+] Successfully connected to remote host {remote_host}:{remote_port}")
+        if transcript_dir:
+            transcript = Transcript(transcript_dir)
 
         # Start two threads to manage bi-directional data flow
         # C2S = Client to Server, S2C = Server to Client
         client_to_server_thread = threading.Thread(target=forward_data, 
-                                                  args=(client_socket, remote_socket, "C2S ->"))
+                                                  args=(client_socket, remote_socket, "C2S ->", transcript))
         server_to_client_thread = threading.Thread(target=forward_data, 
-                                                  args=(remote_socket, client_socket, "<- S2C"))
+                                                  args=(remote_socket, client_socket, "<- S2C", transcript))
 
         client_to_server_thread.start()
         server_to_client_thread.start()
@@ -81,10 +119,13 @@ def client_handler(client_socket, remote_host, remote_port):
     finally:
         if remote_socket:
             remote_socket.close()
+        if transcript:
+            transcript.close()
         print(f"[*] Client session closed.")
 
 
 def main():
+    transcript_dir = sys.argv[1] if len(sys.argv) > 1 else None
     print(f"[*] Starting TCP proxy on {LISTEN_HOST}:{LISTEN_PORT}")
     print(f"[*] Forwarding to {REMOTE_HOST}:{REMOTE_PORT}")
     
@@ -98,7 +139,7 @@ def main():
         
         # Start a new thread to handle the client connection
         client_handler_thread = threading.Thread(target=client_handler, 
-                                                 args=(client_socket, REMOTE_HOST, REMOTE_PORT))
+                                                 args=(client_socket, REMOTE_HOST, REMOTE_PORT, transcript_dir))
         client_handler_thread.start()
 
 if __name__ == "__main__":